@@ -0,0 +1,89 @@
+# Compares clean and incremental build times of TestAll with and without build acceleration.
+#
+# TestAll is configured and built from scratch in each of the following configurations:
+#
+#   baseline: neither precompiled headers nor modules
+#   pch:      SEQUOIA_PRECOMPILED_HEADERS=ON
+#   modules:  SEQUOIA_MODULES=ON
+#
+# After each clean build, TOUCH_FILE is touched and TestAll rebuilt, to time an edit-build cycle.
+# Results, in seconds, are written to OUTPUT_DIR/build_configurations.csv
+#
+# Usage: cmake -DTESTALL_DIR=<dir> -DOUTPUT_DIR=<dir> -DGENERATOR=<generator> -DCXX=<compiler>
+#              -DTOUCH_FILE=<test source> [-DBUILD_TYPE=Release] [-DJOBS=<n>] [-DCONFIGURATIONS=baseline,pch,modules]
+#              -P BuildConfigurationBenchmark.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(var TESTALL_DIR OUTPUT_DIR GENERATOR CXX TOUCH_FILE)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "BuildConfigurationBenchmark: ${var} must be defined")
+    endif()
+endforeach()
+
+if(NOT DEFINED BUILD_TYPE)
+    set(BUILD_TYPE Release)
+endif()
+
+if(NOT DEFINED CONFIGURATIONS)
+    set(CONFIGURATIONS baseline,pch,modules)
+endif()
+
+string(REPLACE "," ";" CONFIGURATIONS "${CONFIGURATIONS}")
+
+set(jobsArgs "")
+if(JOBS)
+    set(jobsArgs --parallel ${JOBS})
+endif()
+
+# Sets result to the elapsed seconds, to one decimal place
+FUNCTION(timed_build binaryDir result)
+    string(TIMESTAMP start "%s%f" UTC)
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${binaryDir} --target TestAll ${jobsArgs}
+                    RESULT_VARIABLE exitCode
+                    OUTPUT_QUIET)
+    string(TIMESTAMP stop "%s%f" UTC)
+
+    if(NOT exitCode EQUAL 0)
+        message(FATAL_ERROR "BuildConfigurationBenchmark: build in ${binaryDir} failed")
+    endif()
+
+    math(EXPR tenths "(${stop} - ${start}) / 100000")
+    math(EXPR whole "${tenths} / 10")
+    math(EXPR fraction "${tenths} % 10")
+    set(${result} "${whole}.${fraction}" PARENT_SCOPE)
+ENDFUNCTION()
+
+set(report "configuration,clean_s,incremental_s\n")
+foreach(configuration IN LISTS CONFIGURATIONS)
+    if(configuration STREQUAL "baseline")
+        set(options -DSEQUOIA_PRECOMPILED_HEADERS=OFF -DSEQUOIA_MODULES=OFF)
+    elseif(configuration STREQUAL "pch")
+        set(options -DSEQUOIA_PRECOMPILED_HEADERS=ON -DSEQUOIA_MODULES=OFF)
+    elseif(configuration STREQUAL "modules")
+        set(options -DSEQUOIA_PRECOMPILED_HEADERS=OFF -DSEQUOIA_MODULES=ON)
+    else()
+        message(FATAL_ERROR "BuildConfigurationBenchmark: unrecognized configuration '${configuration}'")
+    endif()
+
+    set(binaryDir ${OUTPUT_DIR}/${configuration})
+    file(REMOVE_RECURSE ${binaryDir})
+    execute_process(COMMAND ${CMAKE_COMMAND} -S ${TESTALL_DIR} -B ${binaryDir} -G ${GENERATOR}
+                            -DCMAKE_CXX_COMPILER=${CXX} -DCMAKE_BUILD_TYPE=${BUILD_TYPE} ${options}
+                    RESULT_VARIABLE exitCode
+                    OUTPUT_QUIET)
+
+    if(NOT exitCode EQUAL 0)
+        message(FATAL_ERROR "BuildConfigurationBenchmark: configuring ${configuration} failed")
+    endif()
+
+    timed_build(${binaryDir} clean)
+    file(TOUCH ${TOUCH_FILE})
+    timed_build(${binaryDir} incremental)
+
+    message(STATUS "${configuration}: clean ${clean} s, incremental ${incremental} s")
+    string(APPEND report "${configuration},${clean},${incremental}\n")
+endforeach()
+
+file(WRITE ${OUTPUT_DIR}/build_configurations.csv "${report}")
+message(STATUS "Results written to ${OUTPUT_DIR}/build_configurations.csv")
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Build-cost case: a graph of each flavour, together with traversals.
+*/
+
+#include "sequoia/Maths/Graph/DynamicGraph.hpp"
+#include "sequoia/Maths/Graph/DynamicTree.hpp"
+#include "sequoia/Maths/Graph/GraphTraversalFunctions.hpp"
+#include "sequoia/Maths/Graph/HeterogeneousStaticGraph.hpp"
+#include "sequoia/Maths/Graph/StaticGraph.hpp"
+
+namespace sequoia::benchmarks
+{
+  using namespace maths;
+
+  template<class G>
+  std::size_t exercise_dynamic()
+  {
+    G g{};
+    g.add_node();
+    g.add_node();
+    g.add_node();
+    g.join(0, 1);
+    g.join(1, 2);
+
+    std::size_t count{};
+    traverse(breadth_first, g, find_disconnected_t{}, [&count](auto) { ++count; });
+    traverse(depth_first, g, find_disconnected_t{}, [&count](auto) { ++count; });
+    traverse(pseudo_depth_first, g, find_disconnected_t{}, [&count](auto) { ++count; });
+
+    return count;
+  }
+
+  template<class G>
+  std::size_t exercise_static(const G& g)
+  {
+    std::size_t count{};
+    traverse(breadth_first, g, find_disconnected_t{}, [&count](auto) { ++count; });
+
+    return count;
+  }
+
+  std::size_t exercise_all()
+  {
+    using static_directed_t   = static_directed_graph<1, 2, float, double>;
+    using static_undirected_t = static_undirected_graph<1, 2, float, double>;
+    using heterogeneous_t     = heterogeneous_directed_graph<1, 2, float, int, double>;
+
+    using directed_edge_t      = static_directed_t::edge_init_type;
+    using undirected_edge_t    = static_undirected_t::edge_init_type;
+    using heterogeneous_edge_t = heterogeneous_t::edge_init_type;
+
+    return exercise_dynamic<directed_graph<null_weight, null_weight>>()
+         + exercise_dynamic<directed_graph<double, int>>()
+         + exercise_dynamic<undirected_graph<null_weight, null_weight>>()
+         + exercise_dynamic<undirected_graph<double, int>>()
+         + exercise_dynamic<embedded_graph<null_weight, null_weight>>()
+         + exercise_dynamic<embedded_graph<double, int>>()
+         + exercise_static(static_directed_t{{directed_edge_t{1, 0.5f}}, {}})
+         + exercise_static(static_undirected_t{{undirected_edge_t{1, 0.5f}}, {undirected_edge_t{0, 0.5f}}})
+         + heterogeneous_t{{heterogeneous_edge_t{1, 0.5f}}, {}}.order();
+  }
+
+  std::size_t exercise_trees()
+  {
+    directed_tree<tree_link_direction::forward, null_weight, int> t{};
+    t.add_node(directed_tree<tree_link_direction::forward, null_weight, int>::npos, 0);
+    t.add_node(0, 1);
+
+    undirected_tree<tree_link_direction::symmetric, null_weight, int> u{};
+    u.add_node(undirected_tree<tree_link_direction::symmetric, null_weight, int>::npos, 0);
+    u.add_node(0, 1);
+
+    return t.order() + u.order();
+  }
+}
@@ -0,0 +1,48 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Build-cost case: physical values in each unit system, including derived quantities and conversions.
+*/
+
+#include "sequoia/Physics/PhysicalValues.hpp"
+
+namespace sequoia::benchmarks
+{
+  using namespace physics;
+
+  template<std::floating_point T>
+  auto exercise_si()
+  {
+    const si::mass<T> m{1.0, si::units::kilogram};
+    const si::length<T> l{2.0, si::units::metre};
+    const si::time_interval<T> t{3.0, si::units::second};
+    const si::temperature_celsius<T> theta{4.0, si::units::celsius};
+    const si::electrical_current<T> i{5.0, si::units::ampere};
+    const si::angle<T> phi{0.5, si::units::radian};
+
+    return std::tuple{m * l / (t * t), (m + m).convert_to(si::units::tonne), l * l * l, theta, i * t, sin(phi)};
+  }
+
+  template<std::floating_point T>
+  auto exercise_non_si()
+  {
+    const auto area{physical_value{T(1.0), si::units::metre * si::units::metre}.convert_to(non_si::units::foot * non_si::units::foot)};
+    const auto theta{si::temperature_celsius<T>{T(100.0), si::units::celsius}.convert_to(non_si::units::farenheight)};
+    const auto phi{si::angle<T>{T(1.0), si::units::radian}.convert_to(non_si::units::degree)};
+
+    return std::tuple{area, theta, phi};
+  }
+
+  void exercise_all()
+  {
+    exercise_si<float>();
+    exercise_si<double>();
+    exercise_non_si<float>();
+    exercise_non_si<double>();
+  }
+}
@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Build-cost case: a large, heterogeneous suite, of the sort from which tests are extracted.
+*/
+
+#include "sequoia/Core/Object/Suite.hpp"
+
+namespace sequoia::benchmarks
+{
+  using namespace object;
+
+  template<int I>
+  struct item
+  {
+    int value{I};
+
+    [[nodiscard]]
+    friend bool operator==(const item&, const item&) noexcept = default;
+  };
+
+  template<int Group, int... Is>
+  [[nodiscard]]
+  auto make_group(std::integer_sequence<int, Is...>)
+  {
+    return suite{"group", item<Group * 10 + Is>{}...};
+  }
+
+  template<int... Groups>
+  [[nodiscard]]
+  auto make_suite(std::integer_sequence<int, Groups...>)
+  {
+    return suite{"root", make_group<Groups>(std::make_integer_sequence<int, 10>{})...};
+  }
+
+  [[nodiscard]]
+  std::size_t exercise_all()
+  {
+    return extract_leaves(make_suite(std::make_integer_sequence<int, 8>{}), [](auto&&...) { return true; }).size();
+  }
+}
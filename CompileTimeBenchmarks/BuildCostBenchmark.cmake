@@ -0,0 +1,120 @@
+# Measures the build cost of the header-only libraries.
+#
+# Each .cpp in CASES_DIR instantiates a representative set of templates. For every sequoia
+# header which a case includes, and for every case, the following are reported:
+#
+#   frontend_ms:      the fastest syntax-only compilation of a translation unit comprising just the include(s)
+#   instantiation_ms: for cases, the additional time taken to compile the case itself
+#
+# Results are written to OUTPUT_DIR/build_cost.csv and, if the sources are in a git repository,
+# also to OUTPUT_DIR/build_cost_<commit>.csv, for comparison via CompareBuildCosts.cmake.
+# In addition, each case is compiled once more with -ftime-trace (clang) or -ftime-report (gcc),
+# the output of which is placed in OUTPUT_DIR/Traces, for drilling down into regressions.
+#
+# Usage: cmake -DCXX=<compiler> -DCXX_FLAGS=<flags> -DSOURCE_DIR=<sequoia/Source> -DCASES_DIR=<dir>
+#              -DOUTPUT_DIR=<dir> [-DREPETITIONS=3] -P BuildCostBenchmark.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(var CXX SOURCE_DIR CASES_DIR OUTPUT_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "BuildCostBenchmark: ${var} must be defined")
+    endif()
+endforeach()
+
+if(NOT DEFINED REPETITIONS)
+    set(REPETITIONS 3)
+endif()
+
+separate_arguments(CXX_FLAGS)
+set(TRACES_DIR ${OUTPUT_DIR}/Traces)
+file(MAKE_DIRECTORY ${OUTPUT_DIR} ${TRACES_DIR})
+
+include(${CMAKE_CURRENT_LIST_DIR}/CompileTimeUtilities.cmake)
+
+FUNCTION(time_or_fail file result)
+    fastest_compilation(${file} ms)
+    if(ms STREQUAL "")
+        message(FATAL_ERROR "BuildCostBenchmark: ${file} fails to compile")
+    endif()
+
+    set(${result} ${ms} PARENT_SCOPE)
+ENDFUNCTION()
+
+FUNCTION(write_includes file)
+    set(text "")
+    foreach(header IN LISTS ARGN)
+        string(APPEND text "#include \"${header}\"\n")
+    endforeach()
+
+    file(WRITE ${file} "${text}")
+ENDFUNCTION()
+
+FUNCTION(trace file name)
+    execute_process(COMMAND ${CXX} --version OUTPUT_VARIABLE version ERROR_QUIET)
+    if(version MATCHES "clang")
+        execute_process(COMMAND ${CXX} ${CXX_FLAGS} -I${SOURCE_DIR} -ftime-trace -c ${file} -o ${TRACES_DIR}/${name}.o
+                        OUTPUT_QUIET
+                        ERROR_QUIET)
+    else()
+        execute_process(COMMAND ${CXX} ${CXX_FLAGS} -I${SOURCE_DIR} -ftime-report -fsyntax-only ${file}
+                        OUTPUT_QUIET
+                        ERROR_FILE ${TRACES_DIR}/${name}.txt)
+    endif()
+ENDFUNCTION()
+
+file(GLOB cases ${CASES_DIR}/*.cpp)
+list(SORT cases)
+
+set(report "kind,name,frontend_ms,instantiation_ms\n")
+set(timedHeaders "")
+foreach(case IN LISTS cases)
+    get_filename_component(name ${case} NAME_WE)
+
+    file(STRINGS ${case} includes REGEX "^#include \"sequoia/.*\"")
+    list(TRANSFORM includes REPLACE "^#include \"(.*)\".*" "\\1")
+
+    foreach(header IN LISTS includes)
+        if(NOT header IN_LIST timedHeaders)
+            list(APPEND timedHeaders ${header})
+            string(MAKE_C_IDENTIFIER ${header} headerName)
+            set(file ${OUTPUT_DIR}/${headerName}.cpp)
+            write_includes(${file} ${header})
+            time_or_fail(${file} frontend)
+            message(STATUS "${header}: frontend ${frontend} ms")
+            string(APPEND report "header,${header},${frontend},0\n")
+        endif()
+    endforeach()
+
+    set(file ${OUTPUT_DIR}/${name}_includes.cpp)
+    write_includes(${file} ${includes})
+    time_or_fail(${file} frontend)
+    time_or_fail(${case} total)
+    math(EXPR instantiation "${total} - ${frontend}")
+    if(instantiation LESS 0)
+        set(instantiation 0)
+    endif()
+
+    trace(${case} ${name})
+
+    message(STATUS "${name}: frontend ${frontend} ms, instantiation ${instantiation} ms")
+    string(APPEND report "case,${name},${frontend},${instantiation}\n")
+endforeach()
+
+file(WRITE ${OUTPUT_DIR}/build_cost.csv "${report}")
+message(STATUS "Results written to ${OUTPUT_DIR}/build_cost.csv")
+
+find_package(Git QUIET)
+if(GIT_FOUND)
+    execute_process(COMMAND ${GIT_EXECUTABLE} rev-parse --short HEAD
+                    WORKING_DIRECTORY ${SOURCE_DIR}
+                    OUTPUT_VARIABLE commit
+                    OUTPUT_STRIP_TRAILING_WHITESPACE
+                    RESULT_VARIABLE exitCode
+                    ERROR_QUIET)
+
+    if(exitCode EQUAL 0)
+        file(WRITE ${OUTPUT_DIR}/build_cost_${commit}.csv "${report}")
+        message(STATUS "Results also written to ${OUTPUT_DIR}/build_cost_${commit}.csv")
+    endif()
+endif()
@@ -0,0 +1,89 @@
+# Compares two reports written by BuildCostBenchmark.cmake.
+#
+# Each entry present in both reports is listed with its change in frontend and instantiation time.
+# An entry regresses if either time grows by more than THRESHOLD percent and by more than MIN_MS,
+# the latter to suppress noise from cheap entries. If any entry regresses, the script fails.
+#
+# Usage: cmake -DBASELINE=<csv> -DCURRENT=<csv> [-DTHRESHOLD=10] [-DMIN_MS=50] -P CompareBuildCosts.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(var BASELINE CURRENT)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "CompareBuildCosts: ${var} must be defined")
+    endif()
+
+    if(NOT EXISTS ${${var}})
+        message(FATAL_ERROR "CompareBuildCosts: ${${var}} not found")
+    endif()
+endforeach()
+
+if(NOT DEFINED THRESHOLD)
+    set(THRESHOLD 10)
+endif()
+
+if(NOT DEFINED MIN_MS)
+    set(MIN_MS 50)
+endif()
+
+FUNCTION(read_report file prefix)
+    file(STRINGS ${file} lines REGEX "^(header|case),")
+    set(keys "")
+    foreach(line IN LISTS lines)
+        string(REPLACE "," ";" fields "${line}")
+        list(GET fields 0 kind)
+        list(GET fields 1 name)
+        list(GET fields 2 frontend)
+        list(GET fields 3 instantiation)
+        set(key "${kind}:${name}")
+        list(APPEND keys ${key})
+        set(${prefix}_${key}_frontend ${frontend} PARENT_SCOPE)
+        set(${prefix}_${key}_instantiation ${instantiation} PARENT_SCOPE)
+    endforeach()
+
+    set(${prefix}_keys ${keys} PARENT_SCOPE)
+ENDFUNCTION()
+
+FUNCTION(regressed before after result)
+    math(EXPR delta "${after} - ${before}")
+    math(EXPR scaledDelta "${delta} * 100")
+    math(EXPR tolerance "${before} * ${THRESHOLD}")
+    if((delta GREATER MIN_MS) AND (scaledDelta GREATER tolerance))
+        set(${result} TRUE PARENT_SCOPE)
+    else()
+        set(${result} FALSE PARENT_SCOPE)
+    endif()
+ENDFUNCTION()
+
+read_report(${BASELINE} baseline)
+read_report(${CURRENT} current)
+
+set(regressions "")
+foreach(key IN LISTS current_keys)
+    if(NOT key IN_LIST baseline_keys)
+        message(STATUS "${key}: new")
+        continue()
+    endif()
+
+    set(summary "")
+    foreach(phase frontend instantiation)
+        set(before ${baseline_${key}_${phase}})
+        set(after ${current_${key}_${phase}})
+        math(EXPR delta "${after} - ${before}")
+        string(APPEND summary " ${phase} ${before} -> ${after} ms (${delta});")
+
+        regressed(${before} ${after} isRegression)
+        if(isRegression)
+            list(APPEND regressions "${key} ${phase}")
+        endif()
+    endforeach()
+
+    message(STATUS "${key}:${summary}")
+endforeach()
+
+if(regressions)
+    list(JOIN regressions "\n  " regressions)
+    message(FATAL_ERROR "Build-cost regressions beyond ${THRESHOLD}% and ${MIN_MS} ms:\n  ${regressions}")
+endif()
+
+message(STATUS "No build-cost regressions beyond ${THRESHOLD}% and ${MIN_MS} ms")
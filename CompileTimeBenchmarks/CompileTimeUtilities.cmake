@@ -0,0 +1,42 @@
+# Helpers shared by the compile-time benchmark scripts. The including script must define:
+#
+#   CXX:         the compiler
+#   CXX_FLAGS:   the flags with which to compile, as a list
+#   SOURCE_DIR:  the sequoia Source directory
+#   REPETITIONS: the number of timed compilations, of which the fastest is reported
+
+# Sets result to TRUE if file compiles, syntax-only, with any additional flags given after result
+FUNCTION(compiles file result)
+    execute_process(COMMAND ${CXX} ${CXX_FLAGS} -I${SOURCE_DIR} -fsyntax-only ${ARGN} ${file}
+                    RESULT_VARIABLE exitCode
+                    OUTPUT_QUIET
+                    ERROR_QUIET)
+
+    if(exitCode EQUAL 0)
+        set(${result} TRUE PARENT_SCOPE)
+    else()
+        set(${result} FALSE PARENT_SCOPE)
+    endif()
+ENDFUNCTION()
+
+# Sets result to the fastest of REPETITIONS syntax-only compilations in ms, or to "" if file fails to compile
+FUNCTION(fastest_compilation file result)
+    set(fastest "")
+    foreach(rep RANGE 1 ${REPETITIONS})
+        string(TIMESTAMP start "%s%f" UTC)
+        compiles(${file} ok ${ARGN})
+        string(TIMESTAMP stop "%s%f" UTC)
+
+        if(NOT ok)
+            set(${result} "" PARENT_SCOPE)
+            return()
+        endif()
+
+        math(EXPR elapsed "(${stop} - ${start}) / 1000")
+        if((fastest STREQUAL "") OR (elapsed LESS fastest))
+            set(fastest ${elapsed})
+        endif()
+    endforeach()
+
+    set(${result} ${fastest} PARENT_SCOPE)
+ENDFUNCTION()
@@ -0,0 +1,104 @@
+# Measures the cost of sorting type lists with meta::stable_sort.
+#
+# For each list size, a translation unit which sorts that many distinct types is compiled
+# both with meta::type_comparator, which sorts in a single constant evaluation, and with an
+# equivalent comparator which does not opt in to this and so is merge sorted by recursive
+# instantiation. For each case, two figures are reported:
+#
+#   depth: the smallest -ftemplate-depth with which the translation unit compiles
+#   ms:    the fastest of REPETITIONS syntax-only compilations
+#
+# The results are written to OUTPUT_DIR/type_sort_benchmark.csv
+#
+# Usage: cmake -DCXX=<compiler> -DCXX_FLAGS=<flags> -DSOURCE_DIR=<sequoia/Source> -DOUTPUT_DIR=<dir>
+#              -DSIZES=50,100,200,500 [-DREPETITIONS=3] [-DMAX_DEPTH=4096] -P TypeSortBenchmark.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(var CXX SOURCE_DIR OUTPUT_DIR SIZES)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "TypeSortBenchmark: ${var} must be defined")
+    endif()
+endforeach()
+
+if(NOT DEFINED REPETITIONS)
+    set(REPETITIONS 3)
+endif()
+
+if(NOT DEFINED MAX_DEPTH)
+    set(MAX_DEPTH 4096)
+endif()
+
+string(REPLACE "," ";" SIZES "${SIZES}")
+separate_arguments(CXX_FLAGS)
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+include(${CMAKE_CURRENT_LIST_DIR}/CompileTimeUtilities.cmake)
+
+FUNCTION(generate_source file numTypes comparator)
+    math(EXPR last "${numTypes} - 1")
+    set(types "")
+    foreach(i RANGE ${last} 0 -1)
+        list(APPEND types "t<${i}>")
+    endforeach()
+    list(JOIN types ", " types)
+
+    file(WRITE ${file}
+"#include \"sequoia/Core/Meta/TypeAlgorithms.hpp\"
+
+template<int I> struct t {};
+
+template<class T, class U>
+struct recursive_type_comparator : std::bool_constant<(sequoia::meta::type_name<T>() < sequoia::meta::type_name<U>())> {};
+
+using sorted = sequoia::meta::stable_sort_t<std::tuple<${types}>, ${comparator}>;
+
+static_assert(std::tuple_size_v<sorted> == ${numTypes});
+")
+ENDFUNCTION()
+
+FUNCTION(minimum_depth file result)
+    compiles(${file} ok -ftemplate-depth=${MAX_DEPTH})
+    if(NOT ok)
+        set(${result} "" PARENT_SCOPE)
+        return()
+    endif()
+
+    set(lower 1)
+    set(upper ${MAX_DEPTH})
+    while(lower LESS upper)
+        math(EXPR mid "(${lower} + ${upper}) / 2")
+        compiles(${file} ok -ftemplate-depth=${mid})
+        if(ok)
+            set(upper ${mid})
+        else()
+            math(EXPR lower "${mid} + 1")
+        endif()
+    endwhile()
+
+    set(${result} ${upper} PARENT_SCOPE)
+ENDFUNCTION()
+
+set(report "comparator,types,depth,ms\n")
+foreach(numTypes IN LISTS SIZES)
+    foreach(comparator sequoia::meta::type_comparator recursive_type_comparator)
+        string(REGEX REPLACE ".*::" "" name ${comparator})
+        set(file ${OUTPUT_DIR}/${name}_${numTypes}.cpp)
+        generate_source(${file} ${numTypes} ${comparator})
+
+        minimum_depth(${file} depth)
+        if(depth STREQUAL "")
+            message(WARNING "TypeSortBenchmark: ${file} fails to compile with -ftemplate-depth=${MAX_DEPTH}")
+            set(depth "n/a")
+            set(ms "n/a")
+        else()
+            fastest_compilation(${file} ms -ftemplate-depth=${MAX_DEPTH})
+        endif()
+
+        message(STATUS "${name}, ${numTypes} types: depth ${depth}, ${ms} ms")
+        string(APPEND report "${name},${numTypes},${depth},${ms}\n")
+    endforeach()
+endforeach()
+
+file(WRITE ${OUTPUT_DIR}/type_sort_benchmark.csv "${report}")
+message(STATUS "Results written to ${OUTPUT_DIR}/type_sort_benchmark.csv")
@@ -16,13 +16,23 @@
            method.
  */
 
+#include "sequoia/Core/Concurrency/Futures.hpp"
+#include "sequoia/Core/Concurrency/PoolMetrics.hpp"
+#include "sequoia/Core/Concurrency/PriorityTaskQueue.hpp"
+#include "sequoia/Core/Concurrency/Topology.hpp"
 #include "sequoia/Core/Meta/TypeTraits.hpp"
 
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <queue>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <future>
+#include <stdexcept>
+#include <stop_token>
 
 namespace sequoia::concurrency
 {
@@ -57,6 +67,16 @@ namespace sequoia::concurrency
       m_CV.notify_all();
     }
 
+    /// Discards all queued tasks, which are destroyed once the lock has been released
+    void clear()
+    {
+      Q discarded{};
+      {
+        std::scoped_lock<std::mutex> lock{m_Mutex};
+        std::swap(m_Q, discarded);
+      }
+    }
+
     void push(task_t&& task)
     {
       {
@@ -123,20 +143,249 @@ namespace sequoia::concurrency
     }
   };
 
+  /*! \brief A bounded, lock-free task queue designed for use by multiple producers and consumers.
+
+      Each slot of the ring buffer carries a sequence number which determines whether it is
+      ready to be written or read, so that producers and consumers only contend via a CAS on
+      their respective positions. The interface mirrors that of task_queue, allowing this
+      class to be used as the queue of a single-pipeline thread_pool:
+
+        - `push(task)` provides backpressure, blocking while the queue is full;
+        - `push(task, std::try_to_lock)` returns false, leaving `task` untouched, if the queue is full;
+        - `pop()` parks the calling thread until either a task arrives or `finish` is called.
+
+      Blocked threads wait on an atomic epoch counter which, on platforms supporting it, is
+      implemented directly on top of a futex. Producers and consumers only issue a wake-up if
+      some thread is actually parked.
+
+      The capacity must be a power of two and at least two: with a single slot, the sequence
+      number marking the slot as full would coincide with that marking it ready for the next push.
+   */
+  template<class R, std::size_t Capacity=1024, class Task=std::packaged_task<R()>>
+    requires (std::has_single_bit(Capacity) && (Capacity >= 2))
+  class bounded_task_queue
+  {
+  public:
+    using task_t = Task;
+
+    constexpr static std::size_t capacity{Capacity};
+
+    bounded_task_queue()
+    {
+      for(std::size_t i{}; i < Capacity; ++i)
+        m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    bounded_task_queue(const bounded_task_queue&) = delete;
+    bounded_task_queue(bounded_task_queue&&)      = delete;
+
+    ~bounded_task_queue() = default;
+
+    bounded_task_queue& operator=(const bounded_task_queue&) = delete;
+    bounded_task_queue& operator=(bounded_task_queue&&)      = delete;
+
+    void finish()
+    {
+      m_Finished.store(true);
+      signal(m_PushEpoch, m_ParkedConsumers, true);
+      signal(m_PopEpoch, m_ParkedProducers, true);
+    }
+
+    /// Discards all queued tasks
+    void clear()
+    {
+      while(pop(std::try_to_lock).valid()) {}
+    }
+
+    void push(task_t&& task)
+    {
+      while(true)
+      {
+        const auto epoch{m_PopEpoch.load()};
+        if(push(std::move(task), std::try_to_lock)) return;
+
+        park(m_PopEpoch, epoch, m_ParkedProducers);
+      }
+    }
+
+    [[nodiscard]]
+    bool push(task_t&& task, std::try_to_lock_t)
+    {
+      if(!enqueue(task)) return false;
+
+      signal(m_PushEpoch, m_ParkedConsumers, false);
+      return true;
+    }
+
+    [[nodiscard]]
+    task_t pop(std::try_to_lock_t)
+    {
+      task_t task{dequeue()};
+      if(task.valid()) signal(m_PopEpoch, m_ParkedProducers, false);
+
+      return task;
+    }
+
+    [[nodiscard]]
+    task_t pop()
+    {
+      while(true)
+      {
+        const auto epoch{m_PushEpoch.load()};
+        if(task_t task{pop(std::try_to_lock)}; task.valid() || m_Finished.load())
+          return task;
+
+        park(m_PushEpoch, epoch, m_ParkedConsumers);
+      }
+    }
+  private:
+    // Keeps the positions written by producers and consumers on separate cache lines
+    constexpr static std::size_t cache_line{64};
+    constexpr static std::size_t mask{Capacity - 1};
+
+    struct cell
+    {
+      std::atomic<std::size_t> sequence{};
+      task_t task{};
+    };
+
+    std::array<cell, Capacity> m_Cells{};
+    alignas(cache_line) std::atomic<std::size_t> m_EnqueuePos{};
+    alignas(cache_line) std::atomic<std::size_t> m_DequeuePos{};
+    alignas(cache_line) std::atomic<std::uint32_t> m_PushEpoch{}, m_PopEpoch{};
+    std::atomic<std::uint32_t> m_ParkedConsumers{}, m_ParkedProducers{};
+    std::atomic<bool> m_Finished{};
+
+    [[nodiscard]]
+    bool enqueue(task_t& task)
+    {
+      auto pos{m_EnqueuePos.load(std::memory_order_relaxed)};
+      while(true)
+      {
+        auto& c{m_Cells[pos & mask]};
+        const auto seq{c.sequence.load(std::memory_order_acquire)};
+        const auto diff{static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos)};
+        if(!diff)
+        {
+          if(m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            c.task = std::move(task);
+            c.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if(diff < 0)
+        {
+          return false;
+        }
+        else
+        {
+          pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    [[nodiscard]]
+    task_t dequeue()
+    {
+      auto pos{m_DequeuePos.load(std::memory_order_relaxed)};
+      while(true)
+      {
+        auto& c{m_Cells[pos & mask]};
+        const auto seq{c.sequence.load(std::memory_order_acquire)};
+        const auto diff{static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1)};
+        if(!diff)
+        {
+          if(m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            task_t task{std::move(c.task)};
+            c.sequence.store(pos + Capacity, std::memory_order_release);
+            return task;
+          }
+        }
+        else if(diff < 0)
+        {
+          return {};
+        }
+        else
+        {
+          pos = m_DequeuePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /// The epoch must be re-read after registering as parked, else a wake-up may be missed
+    static void park(std::atomic<std::uint32_t>& epoch, std::uint32_t expected, std::atomic<std::uint32_t>& parked)
+    {
+      parked.fetch_add(1);
+      epoch.wait(expected);
+      parked.fetch_sub(1);
+    }
+
+    static void signal(std::atomic<std::uint32_t>& epoch, std::atomic<std::uint32_t>& parked, bool all)
+    {
+      epoch.fetch_add(1);
+      if(parked.load())
+      {
+        if(all) epoch.notify_all();
+        else    epoch.notify_one();
+      }
+    }
+  };
+
   namespace impl
   {
-    template<class R, bool MultiChannel> struct queue_details
+    /// A task which is either nullary or accepts a std::stop_token through which it may be asked to stop
+    template<class Fn, class R>
+    concept poolable
+      =    std::move_constructible<Fn>
+        && (   (std::invocable<Fn> && std::is_convertible_v<std::invoke_result_t<Fn>, R>)
+            || (std::invocable<Fn, std::stop_token> && std::is_convertible_v<std::invoke_result_t<Fn, std::stop_token>, R>));
+
+    /*! \brief Adapts a promised_task, which returns void, to a pool whose tasks return R.
+
+        The pool's own future is never retrieved, since the result is handed to the promise. For
+        non-void R, this future is given a default-constructed value if R is default-initializable;
+        otherwise there is no value with which to satisfy it, and so it is given an exception instead.
+     */
+    template<class R, class Fn>
+    class spawned_task
+    {
+    public:
+      spawned_task(promise<R> p, Fn fn)
+        : m_Task{std::move(p), std::move(fn)}
+      {}
+
+      template<class... Args>
+        requires std::invocable<promised_task<R, Fn>&, Args...>
+      R operator()(Args... args)
+      {
+        m_Task(std::move(args)...);
+
+        if constexpr(std::is_void_v<R>)
+          return;
+        else if constexpr(std::default_initializable<R>)
+          return R{};
+        else
+          throw std::future_error{std::future_errc::no_state};
+      }
+    private:
+      promised_task<R, Fn> m_Task;
+    };
+
+    template<class R, bool MultiChannel, class Queue> struct queue_details
     {
-      using Q_t = task_queue<R>;
+      using Q_t = Queue;
       using task_t = typename Q_t::task_t;
       using queue_type = std::vector<Q_t>;
 
       std::size_t push_cycles{};
+      worker_layout layout{};
     };
 
-    template<class R> struct queue_details<R, false>
+    template<class R, class Queue> struct queue_details<R, false, Queue>
     {
-      using Q_t = task_queue<R>;
+      using Q_t = Queue;
       using task_t = typename Q_t::task_t;
       using queue_type = Q_t;
     };
@@ -190,11 +439,27 @@ namespace sequoia::concurrency
 
   /*! \brief Supports either a single pipeline or a pipeline for each thread, together with task
       stealing.
+
+      The queue type may be replaced; for example, a single-pipeline pool with a lock-free queue
+      is given by thread_pool<R, false, bounded_task_queue<R>>. Note that, in this case, a task
+      which pushes to a full queue will block until a worker frees a slot.
+
+      Tasks may accept a std::stop_token, which is signalled by `cancel_all`. This also discards
+      every task which has been pushed but has not yet started. Each task is destroyed, so that
+      a std::future obtained from `push` throws std::future_error with the code broken_promise,
+      whereas a future obtained from `spawn` throws task_cancelled. Tasks which accept a stop
+      token, or which have a deadline, are checked as they start: such a task throws
+      task_cancelled if it was pushed before a call to `cancel_all`, or if its deadline has expired.
+
+      Supplying pool_metrics as the final template parameter enables counters, sampled latency
+      histograms and, optionally, task tracing, for tuning the number of threads and `push_cycles`.
    */
 
-  template<class R, bool MultiPipeline=true>
-  class thread_pool : private impl::queue_details<R, MultiPipeline>
+  template<class R, bool MultiPipeline=true, class Queue=task_queue<R>, class Metrics=no_pool_metrics>
+  class thread_pool : private impl::queue_details<R, MultiPipeline, Queue>
   {
+    using recorder_type = impl::pool_recorder<Metrics>;
+    constexpr static bool instrumented{recorder_type::enabled};
   public:
     using return_type = R;
 
@@ -206,12 +471,33 @@ namespace sequoia::concurrency
 
     thread_pool(const std::size_t numThreads, const std::size_t pushCycles = 46)
       requires MultiPipeline
-      : impl::queue_details<R, MultiPipeline>{pushCycles}
+      : impl::queue_details<R, MultiPipeline, Queue>{pushCycles, make_worker_layout(numThreads)}
       , m_Queues(numThreads)
     {
       make_pool(numThreads);
     }
 
+    /*! \brief Places the workers on the topology which, by default, is that of the machine */
+    thread_pool(const std::size_t numThreads, const worker_placement placement, const cpu_topology& topology = detect_cpu_topology())
+      requires(!MultiPipeline)
+      : m_Affinities{make_affinities(make_worker_layout(topology, numThreads), placement, topology)}
+    {
+      make_pool(numThreads);
+    }
+
+    /*! \brief Places the workers on the topology which, by default, is that of the machine.
+
+        Idle workers attempt to steal from the pipelines of their own node before those of remote nodes.
+     */
+    thread_pool(const std::size_t numThreads, const worker_placement placement, const cpu_topology& topology = detect_cpu_topology(), const std::size_t pushCycles = 46)
+      requires MultiPipeline
+      : impl::queue_details<R, MultiPipeline, Queue>{pushCycles, make_worker_layout(topology, numThreads)}
+      , m_Queues(numThreads)
+      , m_Affinities{make_affinities(this->layout, placement, topology)}
+    {
+      make_pool(numThreads);
+    }
+
     thread_pool(const thread_pool&)= delete;
     thread_pool(thread_pool&&)     = delete;
 
@@ -223,34 +509,47 @@ namespace sequoia::concurrency
     thread_pool& operator=(const thread_pool&) = delete;
     thread_pool& operator=(thread_pool&&)      = delete;
 
-    template<std::invocable Fn>
-      requires std::is_convertible_v<std::invoke_result_t<Fn>, R> && std::move_constructible<Fn>
+    template<class Fn>
+      requires impl::poolable<Fn, R>
     [[nodiscard]]
     std::future<R> push(Fn fn)
     {
-      task_t task{std::move(fn)};
-      std::future<R> f{task.get_future()};
+      return submit(make_task(std::move(fn)));
+    }
 
-      if constexpr(MultiPipeline)
-      {
-        const auto qIndex{m_QueueIndex++};
-        const auto N{m_Threads.size()};
+    /*! \brief Pushes a task which is cancelled if it has not started by the deadline */
+    template<class Fn>
+      requires impl::poolable<Fn, R>
+    [[nodiscard]]
+    std::future<R> push(Fn fn, const task_clock::time_point deadline)
+    {
+      return submit(make_task(std::move(fn), deadline));
+    }
 
-        if(qIndex >= N)
-        {
-          for(std::size_t i{}; i < N * this->push_cycles; ++i)
-          {
-            if(m_Queues[(qIndex + i) % N].push(std::move(task), std::try_to_lock))
-              return f;
-          }
-        }
+    /*! \brief Pushes a task with the given priority; only available if the pool's queue supports priorities,
+        for example thread_pool<R, false, priority_task_queue<R>>.
+     */
+    template<class Fn>
+      requires impl::poolable<Fn, R> && prioritised_queue<Queue>
+    [[nodiscard]]
+    std::future<R> push(Fn fn, const task_priority& priority)
+    {
+      return submit(make_task(std::move(fn)), priority);
+    }
 
-        m_Queues[qIndex % N].push(std::move(task));
-      }
-      else
-      {
-        m_Queues.push(std::move(task));
-      }
+    /*! \brief Pushes a task, returning a future to which continuations may be attached.
+
+        Continuations run on the worker which completes the task, so that results may be
+        combined, for example via when_all, without a thread blocking on each of them.
+     */
+    template<class Fn>
+      requires impl::poolable<Fn, R>
+    [[nodiscard]]
+    future<R> spawn(Fn fn)
+    {
+      promise<R> p{};
+      auto f{p.get_future()};
+      (void)submit(make_task(impl::spawned_task<R, Fn>{std::move(p), std::move(fn)}));
 
       return f;
     }
@@ -271,28 +570,238 @@ namespace sequoia::concurrency
       join_all();
       joined = true;
     }
+
+    /*! \brief Requests that running tasks stop and discards all tasks which have not yet started.
+
+        The pool remains usable: tasks pushed subsequently are unaffected.
+     */
+    void cancel_all()
+    {
+      m_Generation.fetch_add(1, std::memory_order_acq_rel);
+
+      {
+        std::scoped_lock lock{m_StopMutex};
+        m_StopSource.request_stop();
+        m_StopSource = std::stop_source{};
+      }
+
+      if constexpr(MultiPipeline)
+        for(auto& q : m_Queues) q.clear();
+      else
+        m_Queues.clear();
+    }
+
+    /*! \brief Cancels all tasks and then joins, without waiting for queued work to be done */
+    void shutdown_now()
+    {
+      cancel_all();
+      join();
+    }
+
+    /// Returns a consistent snapshot of each counter, though not of the counters as a whole
+    [[nodiscard]]
+    pool_metrics_snapshot metrics() const
+      requires instrumented
+    {
+      return m_Recorder.snapshot();
+    }
+
+    /*! \brief Writes the span of every task in the Chrome trace format; the pool must have been joined */
+    void write_trace(std::ostream& stream) const
+      requires instrumented && recorder_type::trace
+    {
+      if(!joined)
+        throw std::logic_error{"thread_pool: traces may only be written once the pool has been joined"};
+
+      m_Recorder.write_trace(stream);
+    }
+
+    /// Returns the distribution of queueing times for tasks of the given priority level which have been popped
+    [[nodiscard]]
+    wait_time_histogram wait_times(const std::size_t level) const
+      requires prioritised_queue<Queue>
+    {
+      if constexpr(MultiPipeline)
+      {
+        wait_time_histogram h{};
+        for(const auto& q : m_Queues) h += q.wait_times(level);
+        return h;
+      }
+      else
+      {
+        return m_Queues.wait_times(level);
+      }
+    }
   private:
-    using task_t   = typename impl::queue_details<R, MultiPipeline>::task_t;
-    using Queues_t = typename impl::queue_details<R, MultiPipeline>::queue_type;
+    using task_t   = typename impl::queue_details<R, MultiPipeline, Queue>::task_t;
+    using Queues_t = typename impl::queue_details<R, MultiPipeline, Queue>::queue_type;
 
     Queues_t m_Queues;
     std::vector<std::thread> m_Threads;
     bool joined{};
 
-    std::size_t m_QueueIndex{};
+    /// The cpus to which each worker is confined; empty if placement is left to the operating system
+    std::vector<std::vector<std::size_t>> m_Affinities;
+
+    std::atomic<std::size_t> m_QueueIndex{};
+
+    std::atomic<std::size_t> m_Generation{};
+    std::mutex m_StopMutex;
+    std::stop_source m_StopSource;
+
+    [[no_unique_address]] recorder_type m_Recorder;
+
+    /// Nullary tasks without a deadline are queued as they are, save for any instrumentation
+    template<class Fn>
+    [[nodiscard]]
+    task_t make_task(Fn fn)
+    {
+      if constexpr(std::invocable<Fn>)
+        return instrument(std::move(fn));
+      else
+        return make_task(std::move(fn), task_clock::time_point::max());
+    }
+
+    /// Tasks from a generation which has since been cancelled, or whose deadline has expired, throw rather than being invoked
+    template<class Fn>
+    [[nodiscard]]
+    task_t make_task(Fn fn, const task_clock::time_point deadline)
+    {
+      const auto generation{m_Generation.load(std::memory_order_acquire)};
+      if constexpr(std::invocable<Fn>)
+      {
+        return instrument(
+          [this, fn = std::move(fn), generation, deadline]() mutable -> R {
+            check_not_cancelled(generation, deadline);
+            return fn();
+          }
+        );
+      }
+      else
+      {
+        return instrument(
+          [this, fn = std::move(fn), generation, deadline, token{stop_token()}]() mutable -> R {
+            check_not_cancelled(generation, deadline);
+            return fn(token);
+          }
+        );
+      }
+    }
+
+    template<std::invocable Fn>
+    [[nodiscard]]
+    task_t instrument(Fn fn)
+    {
+      if constexpr(instrumented)
+      {
+        return task_t{
+          [this, fn = std::move(fn), enqueued{m_Recorder.sample()}]() mutable -> R {
+            if(enqueued == task_clock::time_point{}) return fn();
+
+            const auto start{task_clock::now()};
+            struct on_exit
+            {
+              recorder_type& recorder;
+              task_clock::time_point enqueued, start;
+
+              ~on_exit() { recorder.on_sampled(enqueued, start, task_clock::now()); }
+            } recordOnExit{m_Recorder, enqueued, start};
+
+            return fn();
+          }
+        };
+      }
+      else
+      {
+        return task_t{std::move(fn)};
+      }
+    }
+
+    void check_not_cancelled(const std::size_t generation, const task_clock::time_point deadline) const
+    {
+      if(generation != m_Generation.load(std::memory_order_acquire))
+        throw task_cancelled{"thread_pool: task cancelled before starting"};
+
+      if((deadline != task_clock::time_point::max()) && (task_clock::now() > deadline))
+        throw task_cancelled{"thread_pool: task deadline expired before starting"};
+    }
+
+    [[nodiscard]]
+    std::stop_token stop_token()
+    {
+      std::scoped_lock lock{m_StopMutex};
+      return m_StopSource.get_token();
+    }
+
+    template<class... QueueArgs>
+    [[nodiscard]]
+    std::future<R> submit(task_t&& task, const QueueArgs&... queueArgs)
+    {
+      std::future<R> f{task.get_future()};
+      if constexpr(instrumented) m_Recorder.on_push();
+
+      if constexpr(MultiPipeline)
+      {
+        const auto qIndex{m_QueueIndex.fetch_add(1, std::memory_order_relaxed)};
+        const auto N{m_Threads.size()};
+
+        if(qIndex >= N)
+        {
+          for(std::size_t i{}; i < N * this->push_cycles; ++i)
+          {
+            if(m_Queues[(qIndex + i) % N].push(std::move(task), queueArgs..., std::try_to_lock))
+              return f;
+
+            if constexpr(instrumented) m_Recorder.on_push_retry();
+          }
+
+          if constexpr(instrumented) m_Recorder.on_blocking_push();
+        }
+
+        m_Queues[qIndex % N].push(std::move(task), queueArgs...);
+      }
+      else
+      {
+        m_Queues.push(std::move(task), queueArgs...);
+      }
+
+      return f;
+    }
+
+    [[nodiscard]]
+    static std::vector<std::vector<std::size_t>> make_affinities(const worker_layout& layout, const worker_placement placement, const cpu_topology& topology)
+    {
+      std::vector<std::vector<std::size_t>> affinities{};
+      if(placement == worker_placement::none) return affinities;
+
+      for(const auto& slot : layout.workers)
+      {
+        if(placement == worker_placement::pinned)
+          affinities.push_back({slot.cpu});
+        else
+          affinities.push_back(topology.nodes[slot.node].cpus);
+      }
+
+      return affinities;
+    }
 
     void make_pool(const std::size_t numThreads)
     {
       m_Threads.reserve(numThreads);
+      if constexpr(instrumented) m_Recorder.make_workers(numThreads);
 
       for(std::size_t q{}; q<numThreads; ++q)
       {
         auto loop{[=,this]() {
+            // Placement is best effort, since the topology may name cpus which are unavailable to the process
+            if(!m_Affinities.empty())
+              pin_current_thread(m_Affinities[q]);
+
             if constexpr(MultiPipeline)
             {
-              task_t task{m_Queues[q].pop()};
+              task_t task{wait_for_task(q, [this, q]() { return m_Queues[q].pop(); })};
               if(task.valid())
-                task();
+                execute(q, task);
               else
                 return;
             }
@@ -303,23 +812,28 @@ namespace sequoia::concurrency
 
               if constexpr(MultiPipeline)
               {
-                const auto N{m_Threads.size()};
-                for(std::size_t i{}; i<N; ++i)
+                const auto& order{this->layout.steal_order[q]};
+                for(std::size_t i{}; i<order.size(); ++i)
                 {
-                  task = m_Queues[(q+i) % N].pop(std::try_to_lock);
+                  task = m_Queues[order[i]].pop(std::try_to_lock);
+                  if constexpr(instrumented)
+                  {
+                    if(i) m_Recorder.on_steal_attempt(q, task.valid(), this->layout.workers[order[i]].node != this->layout.workers[q].node);
+                  }
+
                   if(task.valid()) break;
                 }
 
                 if(!task.valid())
-                  task = m_Queues[q].pop();
+                  task = wait_for_task(q, [this, q]() { return m_Queues[q].pop(); });
               }
               else
               {
-                task = m_Queues.pop();
+                task = wait_for_task(q, [this]() { return m_Queues.pop(); });
               }
 
               if(task.valid())
-                task();
+                execute(q, task);
               else
                 break;
 
@@ -331,6 +845,37 @@ namespace sequoia::concurrency
       }
     }
 
+    template<std::invocable Pop>
+    [[nodiscard]]
+    task_t wait_for_task(const std::size_t worker, Pop pop)
+    {
+      if constexpr(instrumented)
+      {
+        const auto start{task_clock::now()};
+        task_t task{pop()};
+        m_Recorder.on_idle(worker, task_clock::now() - start);
+        return task;
+      }
+      else
+      {
+        return pop();
+      }
+    }
+
+    void execute(const std::size_t worker, task_t& task)
+    {
+      if constexpr(instrumented)
+      {
+        const auto start{task_clock::now()};
+        task();
+        m_Recorder.on_executed(worker, start, task_clock::now());
+      }
+      else
+      {
+        task();
+      }
+    }
+
     void join_all()
     {
       if constexpr(MultiPipeline)
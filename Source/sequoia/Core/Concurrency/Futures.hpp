@@ -0,0 +1,683 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief A future/promise pair supporting continuations, for composing the results of tasks
+           without parking a thread on each one.
+
+    A continuation attached via `then` runs on the thread which fulfils the promise; for a
+    future obtained from thread_pool::spawn, this is the worker which executed the task. If the
+    future is already ready, the continuation instead runs immediately on the calling thread.
+    Futures made by make_ready_future hold their value inline, so that neither they nor any
+    continuation attached to them allocate.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace sequoia::concurrency
+{
+  template<class T> class future;
+  template<class T> class promise;
+
+  template<class T=void, class... Args>
+  [[nodiscard]]
+  future<T> make_ready_future(Args&&... args);
+
+  template<class T>
+  [[nodiscard]]
+  future<T> make_exceptional_future(std::exception_ptr e);
+
+  /*! \brief The exception stored in the future of a task which is cancelled, or whose deadline
+      expires, before it starts.
+   */
+  class task_cancelled : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  namespace impl
+  {
+    template<class T, class Fn> class promised_task;
+
+    template<class T>
+    using stored_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    /// Either the value or the exception with which a promise was fulfilled
+    template<class T>
+    using outcome = std::variant<stored_t<T>, std::exception_ptr>;
+
+    template<class Fn, class T>
+    struct continuation_result
+    {
+      using type = std::invoke_result_t<Fn, T>;
+    };
+
+    template<class Fn>
+    struct continuation_result<Fn, void>
+    {
+      using type = std::invoke_result_t<Fn>;
+    };
+
+    template<class Fn, class T>
+    using continuation_result_t = typename continuation_result<Fn, T>::type;
+
+    template<class T, class Fn>
+    decltype(auto) invoke_continuation(Fn& fn, stored_t<T>&& value)
+    {
+      if constexpr(std::is_void_v<T>)
+        return std::invoke(fn);
+      else
+        return std::invoke(fn, std::move(value));
+    }
+
+    /// Fulfils the promise with the result of invoking `fn`, or with the exception it throws
+    template<class U, class Fn>
+    void fulfil(promise<U>& p, Fn&& fn)
+    {
+      std::optional<stored_t<U>> result{};
+      try
+      {
+        if constexpr(std::is_void_v<U>)
+        {
+          std::invoke(std::forward<Fn>(fn));
+          result.emplace();
+        }
+        else
+        {
+          result.emplace(std::invoke(std::forward<Fn>(fn)));
+        }
+      }
+      catch(...)
+      {
+        p.set_exception(std::current_exception());
+        return;
+      }
+
+      // Set outside the try block, since any continuation of `p` runs within set_value
+      p.set_value(std::move(*result));
+    }
+
+    template<class T>
+    class future_state
+    {
+    public:
+      using continuation_type = std::move_only_function<void(outcome<T>&&)>;
+
+      void set(outcome<T>&& result)
+      {
+        continuation_type continuation{};
+        {
+          std::scoped_lock lock{m_Mutex};
+          if(m_Satisfied) throw std::future_error{std::future_errc::promise_already_satisfied};
+
+          m_Satisfied = true;
+          if(m_Continuation) continuation = std::move(m_Continuation);
+          else               m_Result     = std::move(result);
+        }
+
+        if(continuation) continuation(std::move(result));
+        else             m_CV.notify_all();
+      }
+
+      [[nodiscard]]
+      bool satisfied() const
+      {
+        std::scoped_lock lock{m_Mutex};
+        return m_Satisfied;
+      }
+
+      [[nodiscard]]
+      bool is_ready() const
+      {
+        std::scoped_lock lock{m_Mutex};
+        return m_Result.has_value();
+      }
+
+      void wait() const
+      {
+        std::unique_lock lock{m_Mutex};
+        m_CV.wait(lock, [this]() { return m_Result.has_value(); });
+      }
+
+      [[nodiscard]]
+      outcome<T> take()
+      {
+        wait();
+        return std::move(*m_Result);
+      }
+
+      /// Invokes the continuation immediately if the result is already available
+      void set_continuation(continuation_type continuation)
+      {
+        {
+          std::scoped_lock lock{m_Mutex};
+          if(!m_Result)
+          {
+            m_Continuation = std::move(continuation);
+            return;
+          }
+        }
+
+        continuation(std::move(*m_Result));
+      }
+    private:
+      mutable std::mutex m_Mutex;
+      mutable std::condition_variable m_CV;
+      std::optional<outcome<T>> m_Result{};
+      continuation_type m_Continuation{};
+
+      /// Set even if the result is handed straight to a continuation, rather than being stored
+      bool m_Satisfied{};
+    };
+
+    /// Grants the combinators access to the outcome of a future, without attaching a continuation per element
+    struct future_access
+    {
+      template<class T, class Callback>
+      static void on_ready(future<T>&& f, Callback callback)
+      {
+        std::move(f).on_ready(std::move(callback));
+      }
+    };
+  }
+
+  /*! \brief The receiving end of a promise, which may be waited upon or extended by a continuation.
+
+      As for std::future, instances are move-only and `get`, `then` and the combinators consume
+      the future, after which it is no longer valid.
+   */
+  template<class T>
+  class future
+  {
+  public:
+    using value_type = T;
+
+    future() noexcept = default;
+
+    future(const future&)     = delete;
+    future(future&&) noexcept = default;
+
+    ~future() = default;
+
+    future& operator=(const future&)     = delete;
+    future& operator=(future&&) noexcept = default;
+
+    [[nodiscard]]
+    bool valid() const noexcept { return m_Result.index() != empty; }
+
+    [[nodiscard]]
+    bool is_ready() const
+    {
+      switch(m_Result.index())
+      {
+      case empty:
+        return false;
+      case shared:
+        return std::get<shared>(m_Result)->is_ready();
+      default:
+        return true;
+      }
+    }
+
+    void wait() const
+    {
+      if(m_Result.index() == shared) std::get<shared>(m_Result)->wait();
+    }
+
+    /*! \brief Blocks until the result is available, then returns it or rethrows the stored exception */
+    T get()
+    {
+      auto result{take()};
+      if(result.index()) std::rethrow_exception(std::get<1>(result));
+
+      if constexpr(!std::is_void_v<T>)
+        return std::move(std::get<0>(result));
+    }
+
+    /*! \brief Returns a future for the result of invoking `fn` on the value of this future.
+
+        If this future holds an exception, `fn` is not invoked and the exception propagates.
+     */
+    template<class Fn>
+      requires std::move_constructible<Fn>
+    [[nodiscard]]
+    future<impl::continuation_result_t<Fn, T>> then(Fn fn) &&
+    {
+      using U = impl::continuation_result_t<Fn, T>;
+
+      if(m_Result.index() != shared)
+      {
+        auto result{take()};
+        if(result.index()) return make_exceptional_future<U>(std::get<1>(result));
+
+        try
+        {
+          if constexpr(std::is_void_v<U>)
+          {
+            impl::invoke_continuation<T>(fn, std::move(std::get<0>(result)));
+            return make_ready_future();
+          }
+          else
+          {
+            return make_ready_future<U>(impl::invoke_continuation<T>(fn, std::move(std::get<0>(result))));
+          }
+        }
+        catch(...)
+        {
+          return make_exceptional_future<U>(std::current_exception());
+        }
+      }
+
+      promise<U> p{};
+      auto f{p.get_future()};
+      std::move(*this).on_ready(
+        [p = std::move(p), fn = std::move(fn)](impl::outcome<T>&& result) mutable {
+          if(result.index()) p.set_exception(std::get<1>(result));
+          else impl::fulfil(p, [&]() -> U { return impl::invoke_continuation<T>(fn, std::move(std::get<0>(result))); });
+        }
+      );
+
+      return f;
+    }
+
+    /*! \brief As for `then`, but the continuation is pushed to `model` rather than being invoked inline.
+
+        The model's `push` should not block on the task's completion; for example, thread_pool<void>.
+        If the model discards the continuation without invoking it, the future receives task_cancelled.
+     */
+    template<class Model, class Fn>
+      requires std::is_void_v<typename Model::return_type> && std::move_constructible<Fn>
+    [[nodiscard]]
+    future<impl::continuation_result_t<Fn, T>> then(Model& model, Fn fn) &&
+    {
+      using U = impl::continuation_result_t<Fn, T>;
+
+      promise<U> p{};
+      auto f{p.get_future()};
+      std::move(*this).on_ready(
+        [&model, p = std::move(p), fn = std::move(fn)](impl::outcome<T>&& result) mutable {
+          if(result.index())
+          {
+            p.set_exception(std::get<1>(result));
+            return;
+          }
+
+          auto continuation{
+            [fn = std::move(fn), value = std::move(std::get<0>(result))]() mutable -> U {
+              return impl::invoke_continuation<T>(fn, std::move(value));
+            }
+          };
+
+          (void)model.push(impl::promised_task<U, decltype(continuation)>{std::move(p), std::move(continuation)});
+        }
+      );
+
+      return f;
+    }
+
+    template<class U, class... Args>
+    friend future<U> make_ready_future(Args&&... args);
+
+    template<class U>
+    friend future<U> make_exceptional_future(std::exception_ptr e);
+  private:
+    friend class promise<T>;
+    friend struct impl::future_access;
+
+    using state_type = impl::future_state<T>;
+
+    constexpr static std::size_t empty{0}, shared{1}, value{2}, exception{3};
+
+    std::variant<std::monostate, std::shared_ptr<state_type>, impl::stored_t<T>, std::exception_ptr> m_Result{};
+
+    template<std::size_t I, class... Args>
+    explicit future(std::in_place_index_t<I> i, Args&&... args)
+      : m_Result{i, std::forward<Args>(args)...}
+    {}
+
+    [[nodiscard]]
+    impl::outcome<T> take()
+    {
+      auto result{std::exchange(m_Result, {})};
+      switch(result.index())
+      {
+      case shared:
+        return std::get<shared>(result)->take();
+      case value:
+        return impl::outcome<T>{std::in_place_index<0>, std::move(std::get<value>(result))};
+      case exception:
+        return impl::outcome<T>{std::in_place_index<1>, std::get<exception>(result)};
+      default:
+        throw std::future_error{std::future_errc::no_state};
+      }
+    }
+
+    /// Invokes the callback with the outcome immediately, if it is available, and otherwise once the promise is fulfilled
+    template<class Callback>
+    void on_ready(Callback callback) &&
+    {
+      if(m_Result.index() == shared)
+        std::get<shared>(std::exchange(m_Result, {}))->set_continuation(std::move(callback));
+      else
+        callback(take());
+    }
+  };
+
+  /*! \brief Returns a future which holds its value inline, without allocating a shared state */
+  template<class T, class... Args>
+  future<T> make_ready_future(Args&&... args)
+  {
+    return future<T>{std::in_place_index<future<T>::value>, std::forward<Args>(args)...};
+  }
+
+  template<class T>
+  future<T> make_exceptional_future(std::exception_ptr e)
+  {
+    return future<T>{std::in_place_index<future<T>::exception>, std::move(e)};
+  }
+
+  /*! \brief The sending end of a future; if destroyed before being fulfilled, the future receives
+      std::future_error with the code broken_promise.
+   */
+  template<class T>
+  class promise
+  {
+  public:
+    promise() : m_State{std::make_shared<state_type>()} {}
+
+    promise(const promise&)     = delete;
+    promise(promise&&) noexcept = default;
+
+    ~promise()
+    {
+      if(m_State && !m_State->satisfied())
+        m_State->set(impl::outcome<T>{std::in_place_index<1>, std::make_exception_ptr(std::future_error{std::future_errc::broken_promise})});
+    }
+
+    promise& operator=(const promise&) = delete;
+
+    /// Any state previously held is abandoned, as though the promise had been destroyed
+    promise& operator=(promise&& other) noexcept
+    {
+      if(this != &other)
+      {
+        promise abandoned{std::move(*this)};
+        m_State     = std::move(other.m_State);
+        m_Retrieved = other.m_Retrieved;
+      }
+
+      return *this;
+    }
+
+    [[nodiscard]]
+    bool valid() const noexcept { return m_State != nullptr; }
+
+    [[nodiscard]]
+    future<T> get_future()
+    {
+      if(!m_State)    throw std::future_error{std::future_errc::no_state};
+      if(m_Retrieved) throw std::future_error{std::future_errc::future_already_retrieved};
+
+      m_Retrieved = true;
+      return future<T>{std::in_place_index<future<T>::shared>, m_State};
+    }
+
+    /// Any continuation attached to the future is invoked on the calling thread
+    template<class... Args>
+      requires std::constructible_from<impl::stored_t<T>, Args...>
+    void set_value(Args&&... args)
+    {
+      state().set(impl::outcome<T>{std::in_place_index<0>, std::forward<Args>(args)...});
+    }
+
+    void set_exception(std::exception_ptr e)
+    {
+      state().set(impl::outcome<T>{std::in_place_index<1>, std::move(e)});
+    }
+  private:
+    using state_type = impl::future_state<T>;
+
+    std::shared_ptr<state_type> m_State;
+    bool m_Retrieved{};
+
+    [[nodiscard]]
+    state_type& state()
+    {
+      if(!m_State) throw std::future_error{std::future_errc::no_state};
+      return *m_State;
+    }
+  };
+
+  namespace impl
+  {
+    /*! \brief Fulfils a promise with the result of a task; if destroyed without having been invoked,
+        for example because the model to which it was pushed discarded it, the promise receives
+        task_cancelled.
+     */
+    template<class T, class Fn>
+    class promised_task
+    {
+    public:
+      promised_task(promise<T> p, Fn fn)
+        : m_Promise{std::move(p)}
+        , m_Fn{std::move(fn)}
+      {}
+
+      promised_task(promised_task&&) noexcept = default;
+
+      ~promised_task()
+      {
+        if(m_Promise.valid())
+          m_Promise.set_exception(std::make_exception_ptr(task_cancelled{"task cancelled before starting"}));
+      }
+
+      promised_task& operator=(promised_task&&) noexcept = default;
+
+      template<class... Args>
+        requires std::invocable<Fn&, Args...>
+      void operator()(Args... args)
+      {
+        auto p{std::move(m_Promise)};
+        fulfil(p, [&]() -> T { return std::invoke(m_Fn, std::move(args)...); });
+      }
+    private:
+      promise<T> m_Promise;
+      Fn m_Fn;
+    };
+
+    template<class R>
+    concept future_range = std::ranges::input_range<R> && requires { typename std::ranges::range_value_t<R>::value_type; }
+                        && std::same_as<std::ranges::range_value_t<R>, future<typename std::ranges::range_value_t<R>::value_type>>;
+
+    template<class T>
+    using when_all_t = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+    template<class T>
+    [[nodiscard]]
+    stored_t<when_all_t<T>> gather(std::vector<std::optional<stored_t<T>>>& values)
+    {
+      if constexpr(std::is_void_v<T>)
+      {
+        return {};
+      }
+      else
+      {
+        std::vector<T> v{};
+        v.reserve(values.size());
+        for(auto& x : values) v.push_back(std::move(*x));
+
+        return v;
+      }
+    }
+
+    template<class T>
+    struct when_all_state
+    {
+      explicit when_all_state(std::size_t n) : values(n), remaining{n} {}
+
+      std::vector<std::optional<stored_t<T>>> values;
+      std::atomic<std::size_t> remaining;
+      std::mutex error_mutex{};
+      std::exception_ptr error{};
+      promise<when_all_t<T>> result{};
+
+      void finish()
+      {
+        if(error) result.set_exception(error);
+        else      result.set_value(gather<T>(values));
+      }
+    };
+  }
+
+  /*! \brief Returns a future which becomes ready once all of `futures` are, holding their values in order.
+
+      If any future holds an exception, the first such exception, in order of completion, is
+      propagated once all futures are ready. If all of the futures are already ready, so is the
+      result, and no shared state is allocated. Since the futures are moved from, `futures` must be
+      an rvalue.
+   */
+  template<impl::future_range Futures>
+    requires (!std::is_lvalue_reference_v<Futures>)
+  [[nodiscard]]
+  auto when_all(Futures&& futures)
+  {
+    using T = typename std::ranges::range_value_t<Futures>::value_type;
+    using result_type = impl::when_all_t<T>;
+
+    std::vector<future<T>> pending{};
+    for(auto&& f : futures) pending.push_back(std::move(f));
+
+    if(std::ranges::all_of(pending, [](const future<T>& f) { return f.is_ready(); }))
+    {
+      std::vector<std::optional<impl::stored_t<T>>> values(pending.size());
+      std::exception_ptr error{};
+      for(std::size_t i{}; i < pending.size(); ++i)
+      {
+        impl::future_access::on_ready(std::move(pending[i]), [&values, &error, i](impl::outcome<T>&& result) {
+          if(!result.index()) values[i].emplace(std::move(std::get<0>(result)));
+          else if(!error)     error = std::get<1>(result);
+        });
+      }
+
+      if(error) return make_exceptional_future<result_type>(error);
+
+      return make_ready_future<result_type>(impl::gather<T>(values));
+    }
+
+    auto pState{std::make_shared<impl::when_all_state<T>>(pending.size())};
+    auto f{pState->result.get_future()};
+    for(std::size_t i{}; i < pending.size(); ++i)
+    {
+      impl::future_access::on_ready(std::move(pending[i]), [pState, i](impl::outcome<T>&& result) {
+        auto& st{*pState};
+        if(result.index())
+        {
+          std::scoped_lock lock{st.error_mutex};
+          if(!st.error) st.error = std::get<1>(result);
+        }
+        else
+        {
+          st.values[i].emplace(std::move(std::get<0>(result)));
+        }
+
+        if(st.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+          st.finish();
+      });
+    }
+
+    return f;
+  }
+
+  template<class T>
+  struct when_any_result
+  {
+    std::size_t index{};
+    T value;
+  };
+
+  template<>
+  struct when_any_result<void>
+  {
+    std::size_t index{};
+  };
+
+  /*! \brief Returns a future which becomes ready as soon as any of `futures` is, holding its index
+      and value, or its exception. The remaining futures are discarded, so `futures` must be an rvalue.
+
+      Throws std::logic_error if `futures` is empty.
+   */
+  template<impl::future_range Futures>
+    requires (!std::is_lvalue_reference_v<Futures>)
+  [[nodiscard]]
+  auto when_any(Futures&& futures)
+  {
+    using T = typename std::ranges::range_value_t<Futures>::value_type;
+    using result_type = when_any_result<T>;
+
+    std::vector<future<T>> pending{};
+    for(auto&& f : futures) pending.push_back(std::move(f));
+
+    if(pending.empty())
+      throw std::logic_error{"when_any: at least one future is required"};
+
+    const auto make_result{
+      [](std::size_t i, impl::outcome<T>&& result) -> result_type {
+        if constexpr(std::is_void_v<T>) return {i};
+        else                            return {i, std::move(std::get<0>(result))};
+      }
+    };
+
+    if(const auto ready{std::ranges::find_if(pending, [](const future<T>& f) { return f.is_ready(); })}; ready != pending.end())
+    {
+      const auto i{static_cast<std::size_t>(std::ranges::distance(pending.begin(), ready))};
+      std::optional<future<result_type>> f{};
+      impl::future_access::on_ready(std::move(*ready), [&f, &make_result, i](impl::outcome<T>&& result) {
+        if(result.index()) f = make_exceptional_future<result_type>(std::get<1>(result));
+        else               f = make_ready_future<result_type>(make_result(i, std::move(result)));
+      });
+
+      return std::move(*f);
+    }
+
+    struct state
+    {
+      std::atomic<bool> done{};
+      promise<result_type> result{};
+    };
+
+    auto pState{std::make_shared<state>()};
+    auto f{pState->result.get_future()};
+    for(std::size_t i{}; i < pending.size(); ++i)
+    {
+      impl::future_access::on_ready(std::move(pending[i]), [pState, i, make_result](impl::outcome<T>&& result) {
+        if(pState->done.exchange(true, std::memory_order_acq_rel)) return;
+
+        if(result.index()) pState->result.set_exception(std::get<1>(result));
+        else               pState->result.set_value(make_result(i, std::move(result)));
+      });
+    }
+
+    return f;
+  }
+}
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Optional metrics and tracing for sequoia::concurrency::thread_pool.
+
+    A pool is instrumented by supplying pool_metrics as its final template parameter. By default,
+    the parameter is no_pool_metrics, in which case the instrumentation compiles out entirely.
+ */
+
+#include "sequoia/Core/Concurrency/PriorityTaskQueue.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+namespace sequoia::concurrency
+{
+  /*! \brief Disables the instrumentation of a thread_pool */
+  struct no_pool_metrics {};
+
+  /*! \brief Enables per-worker counters and latency histograms for one in every `SampleEvery` tasks,
+      together with, if `Trace` is true, a record of the span of every task.
+   */
+  template<std::size_t SampleEvery=64, bool Trace=false>
+    requires (SampleEvery > 0)
+  struct pool_metrics
+  {
+    constexpr static std::size_t sample_every{SampleEvery};
+    constexpr static bool trace{Trace};
+  };
+
+  template<class T>
+  inline constexpr bool is_pool_metrics_v{false};
+
+  template<std::size_t SampleEvery, bool Trace>
+  inline constexpr bool is_pool_metrics_v<pool_metrics<SampleEvery, Trace>>{true};
+
+  struct worker_metrics_snapshot
+  {
+    /// Includes tasks which were cancelled before starting
+    std::size_t tasks_executed{};
+
+    /// Tasks popped from a pipeline other than the worker's own
+    std::size_t tasks_stolen{};
+
+    /// Speculative pops of another worker's pipeline
+    std::size_t steal_attempts{};
+
+    /// Tasks stolen from a worker placed on another NUMA node
+    std::size_t remote_steals{};
+
+    std::chrono::nanoseconds busy_time{}, idle_time{};
+
+    [[nodiscard]]
+    friend bool operator==(const worker_metrics_snapshot&, const worker_metrics_snapshot&) noexcept = default;
+  };
+
+  struct pool_metrics_snapshot
+  {
+    std::vector<worker_metrics_snapshot> workers;
+
+    std::size_t pushes{};
+
+    /// Speculative pushes which failed to acquire a queue; the count is governed by `push_cycles`
+    std::size_t push_retries{};
+
+    /// Pushes which, having exhausted `push_cycles`, fell back to blocking on a queue
+    std::size_t blocking_pushes{};
+
+    /// Tasks pushed but not yet executed, at the time the snapshot was taken
+    std::size_t queue_depth{};
+
+    /// From enqueue to start, for sampled tasks
+    wait_time_histogram queue_latency{};
+
+    /// From start to finish, for sampled tasks
+    wait_time_histogram execution_latency{};
+  };
+
+  struct task_span
+  {
+    std::size_t worker{};
+    task_clock::time_point start{}, finish{};
+  };
+
+  /*! \brief Writes spans in the Chrome trace event format, which may be loaded into Perfetto */
+  inline void write_chrome_trace(std::ostream& stream, const std::vector<task_span>& spans, task_clock::time_point origin)
+  {
+    using std::chrono::duration_cast;
+    using micros = std::chrono::duration<double, std::micro>;
+
+    stream << "{\"traceEvents\":[";
+    for(std::size_t i{}; i < spans.size(); ++i)
+    {
+      const auto& s{spans[i]};
+      if(i) stream << ',';
+      stream << "\n{\"name\":\"task\",\"ph\":\"X\",\"pid\":0,\"tid\":" << s.worker
+             << ",\"ts\":"  << duration_cast<micros>(s.start - origin).count()
+             << ",\"dur\":" << duration_cast<micros>(s.finish - s.start).count() << '}';
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  }
+
+  namespace impl
+  {
+    class atomic_histogram
+    {
+    public:
+      void record(task_clock::duration d) noexcept
+      {
+        m_Counts[wait_time_histogram::bucket(d)].fetch_add(1, std::memory_order_relaxed);
+      }
+
+      [[nodiscard]]
+      wait_time_histogram snapshot() const noexcept
+      {
+        wait_time_histogram h{};
+        for(std::size_t i{}; i < wait_time_histogram::num_buckets; ++i)
+          h.counts[i] = m_Counts[i].load(std::memory_order_relaxed);
+
+        return h;
+      }
+    private:
+      std::array<std::atomic<std::size_t>, wait_time_histogram::num_buckets> m_Counts{};
+    };
+
+    /// Each worker is the sole writer of its counters, which are aligned to avoid false sharing
+    struct alignas(64) worker_counters
+    {
+      std::atomic<std::size_t> tasks_executed{}, tasks_stolen{}, steal_attempts{}, remote_steals{};
+      std::atomic<std::chrono::nanoseconds::rep> busy_time{}, idle_time{};
+      std::vector<task_span> spans{};
+
+      static void add(std::atomic<std::size_t>& counter) noexcept
+      {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      }
+
+      static void add(std::atomic<std::chrono::nanoseconds::rep>& counter, task_clock::duration d) noexcept
+      {
+        const auto ns{std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()};
+        counter.store(counter.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+      }
+    };
+
+    template<class Metrics>
+    class pool_recorder
+    {
+    public:
+      constexpr static bool enabled{false};
+    };
+
+    template<class Metrics>
+      requires is_pool_metrics_v<Metrics>
+    class pool_recorder<Metrics>
+    {
+    public:
+      constexpr static bool enabled{true};
+      constexpr static bool trace{Metrics::trace};
+
+      void make_workers(std::size_t numThreads) { m_Workers = std::vector<worker_counters>(numThreads); }
+
+      void on_push() noexcept { m_Pushes.fetch_add(1, std::memory_order_relaxed); }
+
+      void on_push_retry() noexcept { m_PushRetries.fetch_add(1, std::memory_order_relaxed); }
+
+      void on_blocking_push() noexcept { m_BlockingPushes.fetch_add(1, std::memory_order_relaxed); }
+
+      /// Returns the time of enqueue if the task is to be sampled, and the epoch of the clock otherwise
+      [[nodiscard]]
+      task_clock::time_point sample() noexcept
+      {
+        if(m_Samples.fetch_add(1, std::memory_order_relaxed) % Metrics::sample_every) return {};
+
+        return task_clock::now();
+      }
+
+      void on_sampled(task_clock::time_point enqueued, task_clock::time_point start, task_clock::time_point finish) noexcept
+      {
+        m_QueueLatency.record(start - enqueued);
+        m_ExecutionLatency.record(finish - start);
+      }
+
+      void on_steal_attempt(std::size_t worker, bool succeeded, bool remote) noexcept
+      {
+        auto& w{m_Workers[worker]};
+        worker_counters::add(w.steal_attempts);
+        if(succeeded)
+        {
+          worker_counters::add(w.tasks_stolen);
+          if(remote) worker_counters::add(w.remote_steals);
+        }
+      }
+
+      void on_idle(std::size_t worker, task_clock::duration d) noexcept
+      {
+        worker_counters::add(m_Workers[worker].idle_time, d);
+      }
+
+      void on_executed(std::size_t worker, task_clock::time_point start, task_clock::time_point finish)
+      {
+        auto& w{m_Workers[worker]};
+        worker_counters::add(w.tasks_executed);
+        worker_counters::add(w.busy_time, finish - start);
+        if constexpr(trace)
+          w.spans.push_back({worker, start, finish});
+      }
+
+      [[nodiscard]]
+      pool_metrics_snapshot snapshot() const
+      {
+        pool_metrics_snapshot s{
+          .pushes{m_Pushes.load(std::memory_order_relaxed)},
+          .push_retries{m_PushRetries.load(std::memory_order_relaxed)},
+          .blocking_pushes{m_BlockingPushes.load(std::memory_order_relaxed)},
+          .queue_latency{m_QueueLatency.snapshot()},
+          .execution_latency{m_ExecutionLatency.snapshot()}
+        };
+
+        std::size_t executed{};
+        for(const auto& w : m_Workers)
+        {
+          s.workers.push_back({
+            .tasks_executed{w.tasks_executed.load(std::memory_order_relaxed)},
+            .tasks_stolen{w.tasks_stolen.load(std::memory_order_relaxed)},
+            .steal_attempts{w.steal_attempts.load(std::memory_order_relaxed)},
+            .remote_steals{w.remote_steals.load(std::memory_order_relaxed)},
+            .busy_time{std::chrono::nanoseconds{w.busy_time.load(std::memory_order_relaxed)}},
+            .idle_time{std::chrono::nanoseconds{w.idle_time.load(std::memory_order_relaxed)}}
+          });
+
+          executed += s.workers.back().tasks_executed;
+        }
+
+        s.queue_depth = s.pushes > executed ? s.pushes - executed : 0;
+
+        return s;
+      }
+
+      /// Must only be called once the workers have been joined
+      void write_trace(std::ostream& stream) const
+        requires trace
+      {
+        std::vector<task_span> spans{};
+        for(const auto& w : m_Workers)
+          spans.insert(spans.end(), w.spans.begin(), w.spans.end());
+
+        write_chrome_trace(stream, spans, m_Origin);
+      }
+    private:
+      task_clock::time_point m_Origin{task_clock::now()};
+      std::vector<worker_counters> m_Workers{};
+      std::atomic<std::size_t> m_Pushes{}, m_PushRetries{}, m_BlockingPushes{}, m_Samples{};
+      atomic_histogram m_QueueLatency{}, m_ExecutionLatency{};
+    };
+  }
+}
@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief A task queue with priority classes, deadlines and aging, for opting in to prioritised
+           scheduling in the concurrency models.
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace sequoia::concurrency
+{
+  using task_clock = std::chrono::steady_clock;
+
+  /*! \brief Describes the urgency of a task; level zero is the highest priority.
+
+      Within a priority class, tasks with a deadline are served earliest-deadline-first, ahead of
+      those without, which are served in the order they were pushed.
+   */
+  struct task_priority
+  {
+    std::size_t level{};
+    task_clock::time_point deadline{task_clock::time_point::max()};
+  };
+
+  /*! \brief Counts of the time spent by tasks waiting in a queue, in buckets whose widths double.
+
+      Bucket zero holds waits of less than one microsecond; bucket i > 0 holds waits in
+      [2^(i-1), 2^i) microseconds, save for the final bucket, which is unbounded.
+   */
+  struct wait_time_histogram
+  {
+    constexpr static std::size_t num_buckets{32};
+
+    std::array<std::size_t, num_buckets> counts{};
+
+    void record(task_clock::duration wait) noexcept { ++counts[bucket(wait)]; }
+
+    [[nodiscard]]
+    static std::size_t bucket(task_clock::duration wait) noexcept
+    {
+      const auto micros{static_cast<std::size_t>(std::max(std::chrono::duration_cast<std::chrono::microseconds>(wait).count(), std::chrono::microseconds::rep{}))};
+      return std::min(static_cast<std::size_t>(std::bit_width(micros)), num_buckets - 1);
+    }
+
+    [[nodiscard]]
+    std::size_t total() const noexcept
+    {
+      std::size_t n{};
+      for(auto c : counts) n += c;
+      return n;
+    }
+
+    /// Returns the exclusive upper bound of the bucket, in microseconds
+    [[nodiscard]]
+    constexpr static std::size_t upper_bound(std::size_t bucket) noexcept
+    {
+      return bucket + 1 < num_buckets ? std::size_t{1} << bucket : std::numeric_limits<std::size_t>::max();
+    }
+
+    wait_time_histogram& operator+=(const wait_time_histogram& other) noexcept
+    {
+      for(std::size_t i{}; i < num_buckets; ++i) counts[i] += other.counts[i];
+      return *this;
+    }
+
+    [[nodiscard]]
+    friend bool operator==(const wait_time_histogram&, const wait_time_histogram&) noexcept = default;
+  };
+
+  /*! \brief A task queue in which workers always drain the highest priority non-empty class first.
+
+      To prevent starvation, a class is promoted by one level for each `AgingMillisecs` which its
+      oldest task has spent waiting; setting this to zero disables aging. A class which has been
+      promoted serves its oldest task, rather than the one with the earliest deadline, so that
+      tasks without deadlines cannot be starved by a stream of tasks with them. Tasks pushed
+      without a priority are placed in the lowest class. The interface is otherwise that of
+      task_queue, allowing this class to be used as the queue of a thread_pool.
+   */
+  template<class R, std::size_t NumClasses=3, std::size_t AgingMillisecs=50, class Task=std::packaged_task<R()>>
+    requires (NumClasses > 0)
+  class priority_task_queue
+  {
+  public:
+    using task_t = Task;
+
+    constexpr static std::size_t num_classes{NumClasses};
+
+    priority_task_queue() = default;
+    priority_task_queue(const priority_task_queue&) = delete;
+    priority_task_queue(priority_task_queue&&)      = delete;
+
+    ~priority_task_queue() = default;
+
+    priority_task_queue& operator=(const priority_task_queue&) = delete;
+    priority_task_queue& operator=(priority_task_queue&&)      = delete;
+
+    void finish()
+    {
+      {
+        std::scoped_lock<std::mutex> lock{m_Mutex};
+        m_Finished = true;
+      }
+
+      m_CV.notify_all();
+    }
+
+    /// Discards all queued tasks, which are destroyed once the lock has been released
+    void clear()
+    {
+      std::array<priority_class, NumClasses> discarded{};
+      {
+        std::scoped_lock<std::mutex> lock{m_Mutex};
+        for(std::size_t i{}; i < NumClasses; ++i)
+        {
+          std::swap(m_Classes[i].tasks, discarded[i].tasks);
+          std::swap(m_Classes[i].by_deadline, discarded[i].by_deadline);
+        }
+      }
+    }
+
+    void push(task_t&& task) { push(std::move(task), lowest()); }
+
+    void push(task_t&& task, const task_priority& priority)
+    {
+      {
+        std::scoped_lock<std::mutex> lock{m_Mutex};
+        add(std::move(task), priority);
+      }
+
+      m_CV.notify_one();
+    }
+
+    [[nodiscard]]
+    bool push(task_t&& task, std::try_to_lock_t t) { return push(std::move(task), lowest(), t); }
+
+    [[nodiscard]]
+    bool push(task_t&& task, const task_priority& priority, std::try_to_lock_t t)
+    {
+      if(std::unique_lock<std::mutex> lock{m_Mutex, t}; lock)
+      {
+        add(std::move(task), priority);
+      }
+      else
+      {
+        return false;
+      }
+
+      m_CV.notify_one();
+
+      return true;
+    }
+
+    [[nodiscard]]
+    task_t pop(std::try_to_lock_t t)
+    {
+      if(std::unique_lock<std::mutex> lock{m_Mutex, t}; lock)
+      {
+        return get();
+      }
+
+      return Task{};
+    }
+
+    [[nodiscard]]
+    task_t pop()
+    {
+      std::unique_lock<std::mutex> lock{m_Mutex};
+      while(empty() && !m_Finished) m_CV.wait(lock);
+
+      return get();
+    }
+
+    /// Returns the distribution of waits for tasks popped from the given class
+    [[nodiscard]]
+    wait_time_histogram wait_times(std::size_t level) const
+    {
+      std::scoped_lock<std::mutex> lock{m_Mutex};
+      return m_Classes.at(level).wait_times;
+    }
+  private:
+    struct entry
+    {
+      task_t task;
+      task_clock::time_point deadline, enqueued;
+    };
+
+    /*! The tasks are keyed by the sequence in which they were pushed, and so are held oldest first;
+        the second index orders them earliest-deadline-first, with ties broken by sequence.
+     */
+    struct priority_class
+    {
+      std::map<std::size_t, entry> tasks;
+      std::set<std::pair<task_clock::time_point, std::size_t>> by_deadline;
+      wait_time_histogram wait_times;
+    };
+
+    std::array<priority_class, NumClasses> m_Classes{};
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_CV;
+    std::size_t m_Sequence{};
+    bool m_Finished{};
+
+    [[nodiscard]]
+    constexpr static task_priority lowest() noexcept { return {.level{NumClasses - 1}}; }
+
+    void add(task_t&& task, const task_priority& priority)
+    {
+      if(priority.level >= NumClasses)
+        throw std::out_of_range{"priority_task_queue: priority level out of range"};
+
+      auto& c{m_Classes[priority.level]};
+      const auto sequence{m_Sequence++};
+      c.tasks.emplace(sequence, entry{std::move(task), priority.deadline, task_clock::now()});
+      c.by_deadline.emplace(priority.deadline, sequence);
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+      return std::ranges::all_of(m_Classes, [](const priority_class& c) { return c.tasks.empty(); });
+    }
+
+    /// The level of a class, having been promoted for the time its oldest task has spent waiting
+    [[nodiscard]]
+    static std::ptrdiff_t effective_level(std::size_t level, const entry& oldest, task_clock::time_point now) noexcept
+    {
+      std::ptrdiff_t promotion{};
+      if constexpr(AgingMillisecs > 0)
+        promotion = static_cast<std::ptrdiff_t>((now - oldest.enqueued) / std::chrono::milliseconds{AgingMillisecs});
+
+      return static_cast<std::ptrdiff_t>(level) - promotion;
+    }
+
+    [[nodiscard]]
+    Task get()
+    {
+      const auto now{task_clock::now()};
+      std::size_t selected{NumClasses};
+      std::ptrdiff_t selectedLevel{};
+      for(std::size_t level{}; level < NumClasses; ++level)
+      {
+        const auto& c{m_Classes[level]};
+        if(c.tasks.empty()) continue;
+
+        if(const auto l{effective_level(level, c.tasks.begin()->second, now)}; (selected == NumClasses) || (l < selectedLevel))
+        {
+          selected      = level;
+          selectedLevel = l;
+        }
+      }
+
+      if(selected == NumClasses) return {};
+
+      auto& c{m_Classes[selected]};
+      const bool promoted{selectedLevel < static_cast<std::ptrdiff_t>(selected)};
+      auto node{promoted ? c.tasks.extract(c.tasks.begin()) : c.tasks.extract(c.by_deadline.begin()->second)};
+      c.by_deadline.erase({node.mapped().deadline, node.key()});
+      c.wait_times.record(now - node.mapped().enqueued);
+
+      return std::move(node.mapped().task);
+    }
+  };
+
+  template<class Q>
+  concept prioritised_queue = requires(Q& q, typename Q::task_t&& task, const task_priority& priority, std::size_t level) {
+    q.push(std::move(task), priority);
+    { q.push(std::move(task), priority, std::try_to_lock) } -> std::same_as<bool>;
+    { std::as_const(q).wait_times(level) } -> std::same_as<wait_time_histogram>;
+  };
+}
@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Definitions for Topology.hpp
+*/
+
+#include "sequoia/Core/Concurrency/Topology.hpp"
+
+#include "sequoia/Streaming/Streaming.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#elif defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#endif
+
+namespace sequoia::concurrency
+{
+  namespace fs = std::filesystem;
+
+  namespace
+  {
+    [[nodiscard]]
+    std::size_t to_index(std::string_view s, std::string_view list)
+    {
+      std::size_t i{};
+      if(const auto [ptr, ec]{std::from_chars(s.data(), s.data() + s.size(), i)}; (ec != std::errc{}) || (ptr != s.data() + s.size()))
+        throw std::runtime_error{"parse_cpu_list: unable to parse '" + std::string{list} + "'"};
+
+      return i;
+    }
+
+    [[nodiscard]]
+    std::string_view trim(std::string_view s) noexcept
+    {
+      constexpr std::string_view whitespace{" \t\r\n"};
+      const auto first{s.find_first_not_of(whitespace)};
+      if(first == std::string_view::npos) return {};
+
+      return s.substr(first, s.find_last_not_of(whitespace) - first + 1);
+    }
+
+    [[nodiscard]]
+    std::vector<std::size_t> parse_distances(std::string_view text)
+    {
+      std::vector<std::size_t> distances{};
+      for(auto pos{text.find_first_not_of(" \t\r\n")}; pos != std::string_view::npos; pos = text.find_first_not_of(" \t\r\n", pos))
+      {
+        const auto end{std::min(text.find_first_of(" \t\r\n", pos), text.size())};
+        distances.push_back(to_index(text.substr(pos, end - pos), text));
+        pos = end;
+      }
+
+      return distances;
+    }
+
+    [[nodiscard]]
+    cpu_topology single_node()
+    {
+      std::vector<std::size_t> cpus(std::max(std::thread::hardware_concurrency(), 1u));
+      std::iota(cpus.begin(), cpus.end(), std::size_t{});
+
+      return {{{.id{}, .cpus{std::move(cpus)}, .distances{10}}}};
+    }
+  }
+
+  [[nodiscard]]
+  std::size_t cpu_topology::num_cpus() const noexcept
+  {
+    return std::ranges::fold_left(nodes, std::size_t{}, [](std::size_t n, const numa_node& node) { return n + node.cpus.size(); });
+  }
+
+  [[nodiscard]]
+  std::vector<std::size_t> parse_cpu_list(std::string_view list)
+  {
+    std::vector<std::size_t> cpus{};
+    const auto trimmed{trim(list)};
+    if(trimmed.empty()) return cpus;
+
+    for(std::size_t pos{}; pos <= trimmed.size();)
+    {
+      const auto end{std::min(trimmed.find(',', pos), trimmed.size())};
+      const auto range{trimmed.substr(pos, end - pos)};
+      if(const auto dash{range.find('-')}; dash != std::string_view::npos)
+      {
+        const auto first{to_index(range.substr(0, dash), list)}, last{to_index(range.substr(dash + 1), list)};
+        if(last < first)
+          throw std::runtime_error{"parse_cpu_list: decreasing range in '" + std::string{list} + "'"};
+
+        for(auto i{first}; i <= last; ++i) cpus.push_back(i);
+      }
+      else
+      {
+        cpus.push_back(to_index(range, list));
+      }
+
+      pos = end + 1;
+    }
+
+    return cpus;
+  }
+
+  [[nodiscard]]
+  cpu_topology detect_cpu_topology(const fs::path& sysNodes)
+  {
+    std::error_code ec{};
+    if(!fs::is_directory(sysNodes, ec)) return single_node();
+
+    cpu_topology topology{};
+    for(const auto& entry : fs::directory_iterator{sysNodes, ec})
+    {
+      const auto name{entry.path().filename().string()};
+      if(!entry.is_directory() || !name.starts_with("node") || (name.size() == 4)
+         || !std::ranges::all_of(name.substr(4), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+        continue;
+
+      if(auto cpuList{read_to_string(entry.path() / "cpulist")})
+      {
+        numa_node node{.id{to_index(name.substr(4), name)}, .cpus{parse_cpu_list(*cpuList)}};
+        if(node.cpus.empty()) continue;
+
+        if(const auto distances{read_to_string(entry.path() / "distance")})
+          node.distances = parse_distances(*distances);
+
+        topology.nodes.push_back(std::move(node));
+      }
+    }
+
+    if(topology.nodes.empty()) return single_node();
+
+    std::ranges::sort(topology.nodes, {}, &numa_node::id);
+
+    // The distance files are indexed by node id; re-index by position, dropping memory-only nodes
+    std::vector<std::size_t> ids{};
+    for(const auto& node : topology.nodes) ids.push_back(node.id);
+
+    for(auto& node : topology.nodes)
+    {
+      std::vector<std::size_t> distances(ids.size(), 20);
+      for(std::size_t i{}; i < ids.size(); ++i)
+      {
+        if(ids[i] < node.distances.size()) distances[i] = node.distances[ids[i]];
+        else if(ids[i] == node.id)         distances[i] = 10;
+      }
+
+      node.distances = std::move(distances);
+    }
+
+    return topology;
+  }
+
+  [[nodiscard]]
+  worker_layout make_worker_layout(const cpu_topology& topology, std::size_t numWorkers)
+  {
+    const auto numCpus{topology.num_cpus()};
+    if(!numCpus) return make_worker_layout(numWorkers);
+
+    std::vector<worker_slot> cpus{};
+    for(std::size_t n{}; n < topology.nodes.size(); ++n)
+    {
+      for(const auto cpu : topology.nodes[n].cpus) cpus.push_back({n, cpu});
+    }
+
+    auto layout{make_worker_layout(numWorkers)};
+    for(std::size_t w{}; w < numWorkers; ++w)
+      layout.workers[w] = cpus[(w * numCpus) / numWorkers];
+
+    const auto distance{
+      [&topology](std::size_t from, std::size_t to) -> std::size_t {
+        const auto& d{topology.nodes[from].distances};
+        return to < d.size() ? d[to] : (from == to ? 10 : 20);
+      }
+    };
+
+    // Each worker's own pipeline stays first; the stable sort preserves the rotation within each node
+    for(std::size_t w{}; w < numWorkers; ++w)
+    {
+      const auto home{layout.workers[w].node};
+      std::ranges::stable_sort(layout.steal_order[w], {}, [&](std::size_t v) {
+        const auto node{layout.workers[v].node};
+        return std::pair{v != w, node == home ? std::size_t{} : distance(home, node)};
+      });
+    }
+
+    return layout;
+  }
+
+  bool pin_current_thread(std::span<const std::size_t> cpus) noexcept
+  {
+    if(cpus.empty()) return false;
+
+  #if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(const auto cpu : cpus)
+    {
+      if(cpu >= CPU_SETSIZE) return false;
+      CPU_SET(cpu, &set);
+    }
+
+    return !pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+  #elif defined(_WIN32)
+    DWORD_PTR mask{};
+    for(const auto cpu : cpus)
+    {
+      if(cpu >= 8 * sizeof(DWORD_PTR)) return false;
+      mask |= DWORD_PTR{1} << cpu;
+    }
+
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+  #else
+    return false;
+  #endif
+  }
+}
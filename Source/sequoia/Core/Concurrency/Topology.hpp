@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Discovery of the NUMA topology of the machine, and the placement of workers upon it.
+
+    The topology is read from `/sys/devices/system/node`, so that no external library is
+    required. Where this is unavailable, the machine is treated as a single node.
+ */
+
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace sequoia::concurrency
+{
+  struct numa_node
+  {
+    std::size_t id{};
+    std::vector<std::size_t> cpus{};
+
+    /// The relative cost of accessing the memory of each node, indexed by position in the topology
+    std::vector<std::size_t> distances{};
+
+    [[nodiscard]]
+    friend bool operator==(const numa_node&, const numa_node&) noexcept = default;
+  };
+
+  struct cpu_topology
+  {
+    std::vector<numa_node> nodes{};
+
+    [[nodiscard]]
+    std::size_t num_cpus() const noexcept;
+
+    [[nodiscard]]
+    friend bool operator==(const cpu_topology&, const cpu_topology&) noexcept = default;
+  };
+
+  enum class worker_placement {
+    none,     /// workers are placed by the operating system
+    pinned,   /// each worker is pinned to a single cpu
+    numa_node /// each worker is confined to the cpus of a single node
+  };
+
+  struct worker_slot
+  {
+    /// Position of the node in the topology
+    std::size_t node{};
+    std::size_t cpu{};
+
+    [[nodiscard]]
+    friend bool operator==(const worker_slot&, const worker_slot&) noexcept = default;
+  };
+
+  /*! \brief The node and cpu of each worker, together with the order in which each worker visits
+      the pipelines of the pool: its own first, then those of its node, then those of other nodes
+      in order of increasing distance.
+   */
+  struct worker_layout
+  {
+    std::vector<worker_slot> workers{};
+    std::vector<std::vector<std::size_t>> steal_order{};
+
+    [[nodiscard]]
+    friend bool operator==(const worker_layout&, const worker_layout&) noexcept = default;
+  };
+
+  /*! \brief Parses a list of the form "0-3,8,10-11", throwing std::runtime_error if it is malformed */
+  [[nodiscard]]
+  std::vector<std::size_t> parse_cpu_list(std::string_view list);
+
+  [[nodiscard]]
+  cpu_topology detect_cpu_topology(const std::filesystem::path& sysNodes = "/sys/devices/system/node");
+
+  /*! \brief The steal order of a pool without a topology, in which each worker visits the pipelines in turn */
+  [[nodiscard]]
+  inline worker_layout make_worker_layout(std::size_t numWorkers)
+  {
+    worker_layout layout{.workers{std::vector<worker_slot>(numWorkers)}};
+    for(std::size_t w{}; w < numWorkers; ++w)
+    {
+      std::vector<std::size_t> order(numWorkers);
+      for(std::size_t i{}; i < numWorkers; ++i) order[i] = (w + i) % numWorkers;
+
+      layout.steal_order.push_back(std::move(order));
+    }
+
+    return layout;
+  }
+
+  /*! \brief Spreads the workers evenly over the cpus of the topology, taken node by node */
+  [[nodiscard]]
+  worker_layout make_worker_layout(const cpu_topology& topology, std::size_t numWorkers);
+
+  /*! \brief Confines the calling thread to the given cpus.
+
+      Returns false if this is not supported by the platform or fails.
+   */
+  bool pin_current_thread(std::span<const std::size_t> cpus) noexcept;
+}
@@ -18,6 +18,7 @@
 #include "sequoia/Maths/Sequences/MonotonicSequence.hpp"
 #include "sequoia/PlatformSpecific/Preprocessor.hpp"
 
+#include <memory_resource>
 #include <string>
 #include <numeric>
 #include <stdexcept>
@@ -1169,5 +1170,22 @@ namespace sequoia
         return T{*((list.begin() + partitionIndex)->begin() + index)};
       }
     };
+
+    /*! \brief Aliases for partitioned data which draws its memory from a `std::pmr::memory_resource`.
+
+        Combined with the resources in MemoryResources.hpp, these allow the many small
+        allocations made by, for example, a dynamic graph to be served from an arena or pool.
+     */
+    namespace pmr
+    {
+      template<class T>
+      using bucketed_sequence = data_structures::bucketed_sequence<T, std::pmr::vector<std::pmr::vector<T>>>;
+
+      template<class T>
+      using partitioned_sequence
+        = data_structures::partitioned_sequence<T,
+                                                std::pmr::vector<T>,
+                                                maths::monotonic_sequence<std::size_t, std::ranges::greater, std::pmr::vector<std::size_t>>>;
+    }
   }
 }
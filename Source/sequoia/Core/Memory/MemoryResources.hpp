@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Polymorphic memory resources suited to data structures which perform many small allocations.
+
+    Both resources plug into any allocator-aware sequoia container via `std::pmr::polymorphic_allocator`;
+    see, for example, the `pmr` aliases in PartitionedData.hpp.
+ */
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+
+namespace sequoia::memory
+{
+  /*! \brief An arena for which allocation is a pointer bump and deallocation is a no-op.
+
+      All memory is returned to the upstream resource when the arena is destroyed, or upon
+      a call to `release`. Containers using the arena must therefore not outlive it.
+   */
+  using monotonic_arena = std::pmr::monotonic_buffer_resource;
+
+  /*! \brief A resource which serves blocks of a single size from an intrusive free list.
+
+      Blocks are carved from chunks obtained from the upstream resource. Requests which
+      are larger, or more strictly aligned, than the block size are forwarded upstream.
+      Chunks are only returned upstream when the pool is destroyed, or upon a call to `release`.
+      The pool is not thread-safe.
+   */
+  class fixed_size_pool final : public std::pmr::memory_resource
+  {
+  public:
+    explicit fixed_size_pool(const std::size_t blockSize,
+                             const std::size_t blocksPerChunk = 256,
+                             std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : m_BlockSize{round_up(blockSize)}
+      , m_BlocksPerChunk{blocksPerChunk}
+      , m_pUpstream{upstream}
+    {
+      if(!blocksPerChunk)
+        throw std::logic_error{"fixed_size_pool: number of blocks per chunk must be > 0"};
+
+      if(!upstream)
+        throw std::logic_error{"fixed_size_pool: null upstream resource"};
+    }
+
+    fixed_size_pool(const fixed_size_pool&)            = delete;
+    fixed_size_pool& operator=(const fixed_size_pool&) = delete;
+
+    ~fixed_size_pool() override { release(); }
+
+    [[nodiscard]]
+    std::size_t block_size() const noexcept { return m_BlockSize; }
+
+    [[nodiscard]]
+    std::size_t blocks_per_chunk() const noexcept { return m_BlocksPerChunk; }
+
+    [[nodiscard]]
+    std::size_t num_chunks() const noexcept { return m_NumChunks; }
+
+    [[nodiscard]]
+    std::pmr::memory_resource* upstream_resource() const noexcept { return m_pUpstream; }
+
+    void release() noexcept
+    {
+      while(m_pChunks)
+      {
+        chunk_header* pNext{m_pChunks->next};
+        m_pUpstream->deallocate(m_pChunks, chunk_bytes(), alignment);
+        m_pChunks = pNext;
+      }
+
+      m_pFree     = nullptr;
+      m_NumChunks = 0;
+    }
+  private:
+    struct free_block   { free_block* next; };
+    struct chunk_header { chunk_header* next; };
+
+    constexpr static std::size_t alignment{alignof(std::max_align_t)};
+    constexpr static std::size_t header_size{(sizeof(chunk_header) + alignment - 1) / alignment * alignment};
+
+    std::size_t m_BlockSize{}, m_BlocksPerChunk{}, m_NumChunks{};
+    std::pmr::memory_resource* m_pUpstream{};
+    free_block* m_pFree{};
+    chunk_header* m_pChunks{};
+
+    [[nodiscard]]
+    constexpr static std::size_t round_up(const std::size_t bytes) noexcept
+    {
+      const auto size{bytes < sizeof(free_block) ? sizeof(free_block) : bytes};
+      return (size + alignment - 1) / alignment * alignment;
+    }
+
+    [[nodiscard]]
+    std::size_t chunk_bytes() const noexcept { return header_size + m_BlockSize * m_BlocksPerChunk; }
+
+    [[nodiscard]]
+    bool pooled(const std::size_t bytes, const std::size_t align) const noexcept
+    {
+      return (bytes <= m_BlockSize) && (align <= alignment);
+    }
+
+    void add_chunk()
+    {
+      auto pChunk{static_cast<std::byte*>(m_pUpstream->allocate(chunk_bytes(), alignment))};
+      m_pChunks = ::new(pChunk) chunk_header{m_pChunks};
+      ++m_NumChunks;
+
+      auto pBlocks{pChunk + header_size};
+      for(std::size_t i{m_BlocksPerChunk}; i > 0; --i)
+      {
+        m_pFree = ::new(pBlocks + (i - 1) * m_BlockSize) free_block{m_pFree};
+      }
+    }
+
+    [[nodiscard]]
+    void* do_allocate(const std::size_t bytes, const std::size_t align) override
+    {
+      if(!pooled(bytes, align))
+        return m_pUpstream->allocate(bytes, align);
+
+      if(!m_pFree) add_chunk();
+
+      free_block* pBlock{m_pFree};
+      m_pFree = pBlock->next;
+      return pBlock;
+    }
+
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t align) override
+    {
+      if(!pooled(bytes, align))
+      {
+        m_pUpstream->deallocate(p, bytes, align);
+      }
+      else
+      {
+        m_pFree = ::new(p) free_block{m_pFree};
+      }
+    }
+
+    [[nodiscard]]
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+}
@@ -9,6 +9,8 @@
 
 #include "sequoia/Core/Meta/Sequences.hpp"
 
+#include <algorithm>
+#include <array>
 #include <source_location>
 #include <string_view>
 #include <tuple>
@@ -67,6 +69,15 @@ namespace sequoia::meta
 
   template<class T, class U>
   inline constexpr bool type_comparator_v{type_comparator<T, U>::value};
+
+  /*! \brief Opt-in for comparators which order types by `type_name`, for which lists may be sorted
+      by name in constant evaluation, rather than by recursive instantiation.
+   */
+  template<template<class, class> class Compare>
+  inline constexpr bool orders_by_type_name_v{false};
+
+  template<>
+  inline constexpr bool orders_by_type_name_v<type_comparator>{true};
   
   //==================================================== lower_bound ===================================================//
 
@@ -292,9 +303,40 @@ namespace sequoia::meta
     };
   }  
 
+  namespace impl
+  {
+    /*! \brief The stable permutation which orders `Ts...` by `type_name`, computed in a single constant evaluation */
+    template<class... Ts>
+    [[nodiscard]]
+    consteval std::array<std::size_t, sizeof...(Ts)> type_name_order()
+    {
+      constexpr std::array<std::string_view, sizeof...(Ts)> names{type_name<Ts>()...};
+
+      std::array<std::size_t, sizeof...(Ts)> order{};
+      for(std::size_t i{}; i < order.size(); ++i) order[i] = i;
+
+      std::ranges::sort(order, [&names](std::size_t i, std::size_t j) { return (names[i] < names[j]) || ((names[i] == names[j]) && (i < j)); });
+
+      return order;
+    }
+
+    template<class T, class Indices>
+    struct sort_by_type_name;
+
+    template<template<class...> class TT, class... Ts, std::size_t... Is>
+    struct sort_by_type_name<TT<Ts...>, std::index_sequence<Is...>>
+    {
+      constexpr static auto order{type_name_order<Ts...>()};
+      using type = filter_t<TT<Ts...>, std::index_sequence<order[Is]...>>;
+    };
+  }
+
   template<template<class...> class TT, class... Ts, class... Us, template<class, class> class Compare>
     requires (sizeof...(Ts) > 0) && (sizeof...(Us) > 0)
-  struct merge<TT<Ts...>, TT<Us...>, Compare> : impl::merge_from_position<TT<Ts...>, TT<Us...>, 0, Compare>
+  struct merge<TT<Ts...>, TT<Us...>, Compare>
+    : std::conditional_t<orders_by_type_name_v<Compare>,
+                         impl::sort_by_type_name<TT<Ts..., Us...>, std::make_index_sequence<sizeof...(Ts) + sizeof...(Us)>>,
+                         impl::merge_from_position<TT<Ts...>, TT<Us...>, 0, Compare>>
   {};
 
   //==================================================== stable_sort ===================================================//
@@ -317,14 +359,31 @@ namespace sequoia::meta
     using type = TT<T>;
   };
   
+  namespace impl
+  {
+    template<class T, template<class, class> class Compare>
+    struct merge_sort;
+
+    template<template<class...> class TT, class... Ts, template<class, class> class Compare>
+    struct merge_sort<TT<Ts...>, Compare>
+    {
+      constexpr static auto partition{sizeof...(Ts) / 2};
+      using type = merge_t<stable_sort_t<keep_t<TT<Ts...>, partition>, Compare>,
+                           stable_sort_t<drop_t<TT<Ts...>, partition>, Compare>,
+                           Compare>;
+    };
+  }
+
+  /*! For comparators which order by `type_name`, the sort is performed on an array of indices in a single
+      constant evaluation, and the permuted pack expanded in one step. Otherwise, the list is merge sorted
+      by recursive instantiation.
+   */
   template<template<class...> class TT, class... Ts, template<class, class> class Compare>
   struct stable_sort<TT<Ts...>, Compare>
-  {
-    constexpr static auto partition{sizeof...(Ts) / 2};
-    using type = merge_t<stable_sort_t<keep_t<TT<Ts...>, partition>, Compare>,
-                         stable_sort_t<drop_t<TT<Ts...>, partition>, Compare>,
-                         Compare>;
-  };
+    : std::conditional_t<orders_by_type_name_v<Compare>,
+                         impl::sort_by_type_name<TT<Ts...>, std::make_index_sequence<sizeof...(Ts)>>,
+                         impl::merge_sort<TT<Ts...>, Compare>>
+  {};
 
   //==================================================== find ===================================================//
 
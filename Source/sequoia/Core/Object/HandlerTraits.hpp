@@ -26,4 +26,10 @@ namespace sequoia::object
     { h.get(cx) }     -> std::same_as<const typename H::value_type&>;
     { h.get_ptr(cx) } -> std::same_as<const typename H::value_type*>;
   };
+
+  /*! \brief Detects handlers for which copies of a product refer to the same underlying object */
+  template<class H>
+  inline constexpr bool is_shared_handler_v{
+    requires { requires H::is_shared; }
+  };
 }
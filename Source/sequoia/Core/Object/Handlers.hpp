@@ -17,6 +17,8 @@
 #include "sequoia/Core/Object/HandlerTraits.hpp"
 
 #include <memory>
+#include <memory_resource>
+#include <utility>
 
 namespace sequoia::object
 {
@@ -40,6 +42,185 @@ namespace sequoia::object
     using value_type    = T;
     using producer_type = producer<T, std::shared_ptr<T>, make_shared_braced<T>>;
 
+    constexpr static bool is_shared{true};
+
+    [[nodiscard]]
+    static T& get(product_type& ptr) noexcept
+    {
+      return *ptr;
+    }
+
+    [[nodiscard]]
+    static const T& get(const product_type& ptr) noexcept
+    {
+      return *ptr;
+    }
+
+    [[nodiscard]]
+    static T* get_ptr(product_type& ptr) noexcept
+    {
+      return ptr.get();
+    }
+
+    [[nodiscard]]
+    static const T* get_ptr(const product_type& ptr) noexcept
+    {
+      return ptr.get();
+    }
+  };
+
+  /*! \brief Supplies the memory resource from which `counted_ptr` allocates by default.
+
+      To draw from an arena, supply instead a type whose static `get()` returns the arena, either
+      directly to `counted_shared` or via the `shared_weight_handler` of a graph's edge storage config.
+      The process-wide `std::pmr::get_default_resource()` is deliberately not consulted.
+   */
+  struct new_delete_memory_resource
+  {
+    [[nodiscard]]
+    static std::pmr::memory_resource* get() noexcept
+    {
+      return std::pmr::new_delete_resource();
+    }
+  };
+
+  /*! \brief A shared-ownership pointer for which the object and a non-atomic reference count
+      occupy a single allocation.
+
+      The pointer is a single word, rather than the two of `std::shared_ptr`, and copying
+      involves no atomic operations. Consequently, copies must not be shared across threads.
+      The resource used for allocation is recorded, so that deallocation is correct
+      even if the resource provided by `Resource` subsequently changes. A resource may
+      also be passed explicitly on construction, in which case `Resource` is not consulted.
+   */
+  template<class T, class Resource=new_delete_memory_resource>
+  class counted_ptr
+  {
+  public:
+    using element_type = T;
+
+    constexpr counted_ptr() noexcept = default;
+
+    template<class... Args>
+      requires initializable_from<T, Args...>
+    explicit counted_ptr(std::in_place_t, Args&&... args)
+      : counted_ptr{std::allocator_arg, Resource::get(), std::forward<Args>(args)...}
+    {}
+
+    template<class... Args>
+      requires initializable_from<T, Args...>
+    counted_ptr(std::allocator_arg_t, std::pmr::memory_resource* pResource, Args&&... args)
+    {
+      void* pMem{pResource->allocate(sizeof(block), alignof(block))};
+      try
+      {
+        m_pBlock = ::new(pMem) block{1, pResource, T{std::forward<Args>(args)...}};
+      }
+      catch(...)
+      {
+        pResource->deallocate(pMem, sizeof(block), alignof(block));
+        throw;
+      }
+    }
+
+    explicit counted_ptr(T value)
+      : counted_ptr{std::in_place, std::move(value)}
+    {}
+
+    counted_ptr(const counted_ptr& other) noexcept
+      : m_pBlock{other.m_pBlock}
+    {
+      if(m_pBlock) ++m_pBlock->count;
+    }
+
+    counted_ptr(counted_ptr&& other) noexcept
+      : m_pBlock{std::exchange(other.m_pBlock, nullptr)}
+    {}
+
+    ~counted_ptr() { decrement(); }
+
+    counted_ptr& operator=(const counted_ptr& other) noexcept
+    {
+      if(other.m_pBlock) ++other.m_pBlock->count;
+      decrement();
+      m_pBlock = other.m_pBlock;
+      return *this;
+    }
+
+    counted_ptr& operator=(counted_ptr&& other) noexcept
+    {
+      if(&other != this)
+      {
+        decrement();
+        m_pBlock = std::exchange(other.m_pBlock, nullptr);
+      }
+
+      return *this;
+    }
+
+    [[nodiscard]]
+    T* get() const noexcept { return m_pBlock ? std::addressof(m_pBlock->value) : nullptr; }
+
+    [[nodiscard]]
+    T& operator*() const noexcept { return m_pBlock->value; }
+
+    [[nodiscard]]
+    T* operator->() const noexcept { return get(); }
+
+    [[nodiscard]]
+    std::size_t use_count() const noexcept { return m_pBlock ? m_pBlock->count : 0; }
+
+    [[nodiscard]]
+    explicit operator bool() const noexcept { return m_pBlock != nullptr; }
+
+    [[nodiscard]]
+    friend bool operator==(const counted_ptr&, const counted_ptr&) noexcept = default;
+  private:
+    struct block
+    {
+      std::size_t count;
+      std::pmr::memory_resource* resource;
+      T value;
+    };
+
+    block* m_pBlock{};
+
+    void decrement() noexcept
+    {
+      if(m_pBlock && !--m_pBlock->count)
+      {
+        std::pmr::memory_resource* pResource{m_pBlock->resource};
+        m_pBlock->~block();
+        pResource->deallocate(m_pBlock, sizeof(block), alignof(block));
+      }
+    }
+  };
+
+  template<class T, class Resource=new_delete_memory_resource>
+  struct make_counted_braced
+  {
+    template<class... Args>
+      requires initializable_from<T, Args...>
+    [[nodiscard]]
+    counted_ptr<T, Resource> operator()(Args&&... args) const
+    {
+      return counted_ptr<T, Resource>{std::in_place, std::forward<Args>(args)...};
+    }
+  };
+
+  /*! \brief Handler for objects shared via `counted_ptr`, which is suitable for sharing by a
+      single owner, such as a graph, of data which is allocated in bulk from an arena.
+   */
+  template<class T, class Resource=new_delete_memory_resource>
+  struct counted_shared
+  {
+  public:
+    using product_type  = counted_ptr<T, Resource>;
+    using value_type    = T;
+    using producer_type = producer<T, product_type, make_counted_braced<T, Resource>>;
+
+    constexpr static bool is_shared{true};
+
     [[nodiscard]]
     static T& get(product_type& ptr) noexcept
     {
@@ -802,6 +802,46 @@ namespace sequoia::maths
     : std::bool_constant<(Lower == -std::numeric_limits<T>::infinity()) && (Upper == std::numeric_limits<T>::infinity())>
   {};
 
+  /** @ingroup Validators
+      @brief Validates a contiguous batch of values for a space of dimension 1.
+
+      For half-line and interval validators, the batch is first checked with a branch-free
+      reduction. Only if this detects a violation is the validator invoked element-wise, so
+      that precisely the same exception is thrown as for the validation of a single value.
+      Other validators are invoked for each element, with the result written back.
+   */
+  template<class Validator, arithmetic T>
+  constexpr void validate_batch([[maybe_unused]] Validator& validator, [[maybe_unused]] std::span<T> values)
+  {
+    if constexpr(!defines_identity_validator_v<Validator>)
+    {
+      constexpr bool isHalfLine{std::is_same_v<Validator, half_line_validator>}, isInterval{is_interval_validator_v<Validator>};
+      if constexpr(isHalfLine && std::is_unsigned_v<T>)
+      {
+        return;
+      }
+      else if constexpr(isHalfLine || isInterval)
+      {
+        constexpr auto lower{[]() -> T { if constexpr(isInterval) return static_cast<T>(Validator::lower); else return T{}; }()};
+        constexpr auto upper{[]() -> T {
+            if constexpr(isInterval) return static_cast<T>(Validator::upper);
+            else if constexpr(std::numeric_limits<T>::has_infinity) return std::numeric_limits<T>::infinity();
+            else return std::numeric_limits<T>::max();
+          }()
+        };
+
+        bool violated{};
+        for(const auto v : values)
+          violated |= (v < lower) | (v > upper);
+
+        if(!violated) return;
+      }
+
+      for(auto& v : values)
+        v = validator(v);
+    }
+  }
+
   /** @defgroup DirectProduct Direct Product
       @brief Direct Products are one way in which spaces can be composed to create new spaces.
 
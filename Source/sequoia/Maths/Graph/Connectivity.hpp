@@ -171,6 +171,19 @@ namespace sequoia
 
     struct partitions_allocator_tag{};
 
+    /*! \brief Tag asserting that the edges of each partition involved in an operation are sorted
+        by target node, as may be arranged with `sort_edges`.
+
+        Lookups are then performed by binary search, and edges added by `join_unique` are inserted
+        so as to preserve the ordering. It is the caller's responsibility to ensure the precondition.
+     */
+    struct sorted_edges_t
+    {
+      explicit sorted_edges_t() = default;
+    };
+
+    inline constexpr sorted_edges_t sorted_edges{};
+
     /*! \brief Graph connectivity_base, used as a building block for concrete graphs.
     
         This class is flexible, allowing for representations of many different flavours
@@ -262,6 +275,36 @@ namespace sequoia
         return {m_Edges.cbegin_partition(node), m_Edges.cend_partition(node)};
       }
 
+      /// Returns the first edge from node1 to node2 or, if there is none, cend_edges(node1)
+      [[nodiscard]]
+      constexpr const_edge_iterator find_edge(const edge_index_type node1, const edge_index_type node2) const
+      {
+        graph_errors::check_node_index_range("find_edge", order(), node1, node2);
+
+        return std::ranges::find(cedges(node1), node2, [](const edge_type& e) { return e.target_node(); });
+      }
+
+      [[nodiscard]]
+      constexpr const_edge_iterator find_edge(const edge_index_type node1, const edge_index_type node2, sorted_edges_t) const
+      {
+        graph_errors::check_node_index_range("find_edge", order(), node1, node2);
+
+        const auto found{lower_bound_edge(node1, node2)};
+        return (found != cend_edges(node1)) && (found->target_node() == node2) ? found : cend_edges(node1);
+      }
+
+      [[nodiscard]]
+      constexpr bool contains_edge(const edge_index_type node1, const edge_index_type node2) const
+      {
+        return find_edge(node1, node2) != cend_edges(node1);
+      }
+
+      [[nodiscard]]
+      constexpr bool contains_edge(const edge_index_type node1, const edge_index_type node2, sorted_edges_t s) const
+      {
+        return find_edge(node1, node2, s) != cend_edges(node1);
+      }
+
       template<class... Args>
         requires initializable_from<edge_weight_type, Args...>
       constexpr void set_edge_weight(const_edge_iterator citer, Args&&... args)
@@ -706,6 +749,60 @@ namespace sequoia
         }
       }
 
+      /// Joins node1 to node2 unless an edge from the former to the latter already exists, returning true if an edge is added
+      template<class... Args>
+        requires (std::is_empty_v<edge_meta_data_type>&& initializable_from<edge_weight_type, Args...> && (is_directed(flavour) || std::is_copy_constructible_v<edge_type>))
+      bool join_unique(const edge_index_type node1, const edge_index_type node2, Args&&... args)
+      {
+        if(contains_edge(node1, node2)) return false;
+
+        join(node1, node2, std::forward<Args>(args)...);
+        return true;
+      }
+
+      template<class... Args>
+        requires (!std::is_empty_v<edge_meta_data_type>&& initializable_from<edge_weight_type, Args...> && (is_directed(flavour) || std::is_copy_constructible_v<edge_type>))
+      bool join_unique(const edge_index_type node1, const edge_index_type node2, edge_meta_data_type meta1, edge_meta_data_type meta2, Args&&... args)
+      {
+        if(contains_edge(node1, node2)) return false;
+
+        join(node1, node2, std::move(meta1), std::move(meta2), std::forward<Args>(args)...);
+        return true;
+      }
+
+      /// The new edges are inserted in order, and so the partitions remain sorted by target node
+      template<class... Args>
+        requires (std::is_empty_v<edge_meta_data_type>&& initializable_from<edge_weight_type, Args...> && (edge_type::flavour == edge_flavour::partial) && (is_directed(flavour) || std::is_copy_constructible_v<edge_type>))
+      bool join_unique(const edge_index_type node1, const edge_index_type node2, sorted_edges_t s, Args&&... args)
+      {
+        if(contains_edge(node1, node2, s)) return false;
+
+        const auto pos{insert_sorted(node1, node2, std::forward<Args>(args)...)};
+
+        if constexpr(!is_directed(flavour))
+        {
+          sorted_reciprocal_join(node1, pos, node2);
+        }
+
+        return true;
+      }
+
+      template<class... Args>
+        requires (!std::is_empty_v<edge_meta_data_type>&& initializable_from<edge_weight_type, Args...> && (edge_type::flavour == edge_flavour::partial) && (is_directed(flavour) || std::is_copy_constructible_v<edge_type>))
+      bool join_unique(const edge_index_type node1, const edge_index_type node2, sorted_edges_t s, edge_meta_data_type meta1, edge_meta_data_type meta2, Args&&... args)
+      {
+        if(contains_edge(node1, node2, s)) return false;
+
+        const auto pos{insert_sorted(node1, node2, std::move(meta1), std::forward<Args>(args)...)};
+
+        if constexpr(!is_directed(flavour))
+        {
+          sorted_reciprocal_join(node1, pos, node2, std::move(meta2));
+        }
+
+        return true;
+      }
+
       template<class... Args>
         requires (std::is_empty_v<edge_meta_data_type> && initializable_from<edge_weight_type, Args...>&& is_embedded(flavour) && std::is_copy_constructible_v<edge_type>)
       std::pair<const_edge_iterator, const_edge_iterator>
@@ -760,107 +857,17 @@ namespace sequoia
 
       void erase_edge(const_edge_iterator citer)
       {
-        // TO DO: ensure strong exception guarantee (maybe just insist on
-        // noexcept move assignment for m_Edges
-
-        if(!order() || (citer == cend_edges(citer.partition_index()))) return;
-
-        if constexpr (!is_directed(flavour))
-        {
-          const auto source{citer.partition_index()};
-          const auto partner{citer->target_node()};
-
-          auto pred{
-            [=](const edge_type& potentialPartner){
-              if(potentialPartner.target_node() == source)
-              {
-                if constexpr(std::is_empty_v<edge_weight_type>)
-                  return true;
-                else if constexpr(shared_weight_v)
-                  return std::addressof(citer->weight()) == std::addressof(potentialPartner.weight());
-                else if constexpr(std::is_empty_v<edge_meta_data_type>)
-                  return citer->weight() == potentialPartner.weight();
-                else
-                  static_assert(dependent_false<edge_type>::value);
-              }
-
-              return false;
-            }
-          };
-
-          if(source != partner)
-          {
-            if constexpr (edge_type::flavour == edge_flavour::partial_embedded)
-            {
-              const auto partnerLocalIndex{citer->complementary_index()};
-              citer = m_Edges.erase_from_partition(citer);
-              decrement_comp_indices(to_edge_iterator(citer), m_Edges.end_partition(source), 1);
-
-              auto partnerIter{m_Edges.erase_from_partition(partner, partnerLocalIndex)};
-              decrement_comp_indices(partnerIter, m_Edges.end_partition(partner), 1);
-            }
-            else
-            {
-              auto found{std::ranges::find_if(cedges(partner), pred)};
-
-              if(found == cend_edges(partner))
-                throw std::logic_error{graph_errors::erase_edge_error(partner, {source, static_cast<edge_index_type>(std::ranges::distance(cbegin_edges(source), citer))})};
-
-              const auto partnerDist{std::ranges::distance(cbegin_edges(partner), found)};
-
-              m_Edges.erase_from_partition(citer);
-              m_Edges.erase_from_partition(cbegin_edges(partner) + partnerDist);
-            }
-          }
-          else
-          {
-            if constexpr (edge_type::flavour == edge_flavour::partial_embedded)
-            {
-              const auto compIndex{citer->complementary_index()};
-              const auto pos{std::ranges::distance(cbegin_edges(source), citer)};
-              const auto separation{std::ranges::distance(citer, cbegin_edges(source) + compIndex)};
-              if((separation == 1) || (separation == -1))
-              {
-                const auto delta{separation == 1 ? 0 : -1};
-                citer = m_Edges.erase_from_partition(citer+delta, citer+(2+delta));
-
-                decrement_comp_indices(to_edge_iterator(citer), m_Edges.end_partition(source), 2);
-              }
-              else
-              {
-                const bool negativeSeparation{separation < 0};
-
-                auto erase{
-                  [this, source](auto index){
-                    auto i{m_Edges.erase_from_partition(m_Edges.begin_partition(source) + index)};
-                    decrement_comp_indices(i, m_Edges.end_partition(source), 1);
-                  }
-                };
-
-                erase(negativeSeparation ? pos : compIndex);
-                erase(negativeSeparation ? compIndex : pos);
-              }
-            }
-            else
-            {
-              auto found{std::ranges::find_if(cbegin_edges(source), citer, pred)};
-              if(found == citer) found = std::ranges::find_if(std::ranges::next(citer), cend_edges(source), pred);
-
-              if(found == cend_edges(source))
-                throw std::logic_error{graph_errors::erase_edge_error(source, {source, static_cast<edge_index_type>(std::ranges::distance(cbegin_edges(source), citer))})};
-
-              auto dist{std::ranges::distance(cbegin_edges(source), citer)};
-              if(std::ranges::distance(cbegin_edges(source), found) < dist) --dist;
+        erase_edge_impl(citer, [this](const edge_index_type partner, edge_index_type) { return cedges(partner); });
+      }
 
-              m_Edges.erase_from_partition(found);
-              m_Edges.erase_from_partition(cbegin_edges(source) + dist);
-            }
+      /// The partner of an edge of an undirected graph is located by binary search
+      void erase_edge(const_edge_iterator citer, sorted_edges_t)
+        requires (edge_type::flavour == edge_flavour::partial)
+      {
+        erase_edge_impl(citer, [this](const edge_index_type partner, const edge_index_type source) -> const_edges_range {
+            return {lower_bound_edge(partner, source), upper_bound_edge(partner, source)};
           }
-        }
-        else
-        {
-          m_Edges.erase_from_partition(citer);
-        }
+        );
       }
 
       void clear() noexcept
@@ -1458,6 +1465,147 @@ namespace sequoia
         return manipulate_partner_edge_weight(citer, [&args...](edge_iterator iter) -> edge_iterator { iter->weight(std::forward<Args>(args)...); return iter; });
       }
 
+      /// `candidates_of(partner, source)` must return a range of the edges of the partner which includes that complementing `citer`
+      template<class Candidates>
+        requires std::is_invocable_r_v<const_edges_range, Candidates, edge_index_type, edge_index_type>
+      void erase_edge_impl(const_edge_iterator citer, [[maybe_unused]] Candidates candidates_of)
+      {
+        // TO DO: ensure strong exception guarantee (maybe just insist on
+        // noexcept move assignment for m_Edges
+
+        if(!order() || (citer == cend_edges(citer.partition_index()))) return;
+
+        if constexpr (!is_directed(flavour))
+        {
+          const auto source{citer.partition_index()};
+          const auto partner{citer->target_node()};
+
+          auto pred{
+            [=](const edge_type& potentialPartner){
+              if(potentialPartner.target_node() == source)
+              {
+                if constexpr(std::is_empty_v<edge_weight_type>)
+                  return true;
+                else if constexpr(shared_weight_v)
+                  return std::addressof(citer->weight()) == std::addressof(potentialPartner.weight());
+                else if constexpr(std::is_empty_v<edge_meta_data_type>)
+                  return citer->weight() == potentialPartner.weight();
+                else
+                  static_assert(dependent_false<edge_type>::value);
+              }
+
+              return false;
+            }
+          };
+
+          if(source != partner)
+          {
+            if constexpr (edge_type::flavour == edge_flavour::partial_embedded)
+            {
+              const auto partnerLocalIndex{citer->complementary_index()};
+              citer = m_Edges.erase_from_partition(citer);
+              decrement_comp_indices(to_edge_iterator(citer), m_Edges.end_partition(source), 1);
+
+              auto partnerIter{m_Edges.erase_from_partition(partner, partnerLocalIndex)};
+              decrement_comp_indices(partnerIter, m_Edges.end_partition(partner), 1);
+            }
+            else
+            {
+              const auto candidates{candidates_of(partner, source)};
+              auto found{std::ranges::find_if(candidates, pred)};
+
+              if(found == candidates.end())
+                throw std::logic_error{graph_errors::erase_edge_error(partner, {source, static_cast<edge_index_type>(std::ranges::distance(cbegin_edges(source), citer))})};
+
+              const auto partnerDist{std::ranges::distance(cbegin_edges(partner), found)};
+
+              m_Edges.erase_from_partition(citer);
+              m_Edges.erase_from_partition(cbegin_edges(partner) + partnerDist);
+            }
+          }
+          else
+          {
+            if constexpr (edge_type::flavour == edge_flavour::partial_embedded)
+            {
+              const auto compIndex{citer->complementary_index()};
+              const auto pos{std::ranges::distance(cbegin_edges(source), citer)};
+              const auto separation{std::ranges::distance(citer, cbegin_edges(source) + compIndex)};
+              if((separation == 1) || (separation == -1))
+              {
+                const auto delta{separation == 1 ? 0 : -1};
+                citer = m_Edges.erase_from_partition(citer+delta, citer+(2+delta));
+
+                decrement_comp_indices(to_edge_iterator(citer), m_Edges.end_partition(source), 2);
+              }
+              else
+              {
+                const bool negativeSeparation{separation < 0};
+
+                auto erase{
+                  [this, source](auto index){
+                    auto i{m_Edges.erase_from_partition(m_Edges.begin_partition(source) + index)};
+                    decrement_comp_indices(i, m_Edges.end_partition(source), 1);
+                  }
+                };
+
+                erase(negativeSeparation ? pos : compIndex);
+                erase(negativeSeparation ? compIndex : pos);
+              }
+            }
+            else
+            {
+              const auto candidates{candidates_of(source, source)};
+              auto found{std::ranges::find_if(candidates.begin(), citer, pred)};
+              if(found == citer) found = std::ranges::find_if(std::ranges::next(citer), candidates.end(), pred);
+
+              if(found == candidates.end())
+                throw std::logic_error{graph_errors::erase_edge_error(source, {source, static_cast<edge_index_type>(std::ranges::distance(cbegin_edges(source), citer))})};
+
+              auto dist{std::ranges::distance(cbegin_edges(source), citer)};
+              if(std::ranges::distance(cbegin_edges(source), found) < dist) --dist;
+
+              m_Edges.erase_from_partition(found);
+              m_Edges.erase_from_partition(cbegin_edges(source) + dist);
+            }
+          }
+        }
+        else
+        {
+          m_Edges.erase_from_partition(citer);
+        }
+      }
+
+      [[nodiscard]]
+      constexpr const_edge_iterator lower_bound_edge(const edge_index_type node, const edge_index_type target) const
+      {
+        return std::ranges::lower_bound(cedges(node), target, std::ranges::less{}, [](const edge_type& e) { return e.target_node(); });
+      }
+
+      [[nodiscard]]
+      constexpr const_edge_iterator upper_bound_edge(const edge_index_type node, const edge_index_type target) const
+      {
+        return std::ranges::upper_bound(cedges(node), target, std::ranges::less{}, [](const edge_type& e) { return e.target_node(); });
+      }
+
+      /// Returns the position of the new edge within the partition
+      template<class... Args>
+      edge_index_type insert_sorted(const edge_index_type node1, const edge_index_type node2, Args&&... args)
+      {
+        const auto pos{lower_bound_edge(node1, node2)};
+        const auto dist{static_cast<edge_index_type>(std::ranges::distance(cbegin_edges(node1), pos))};
+        m_Edges.insert_to_partition(pos, node2, std::forward<Args>(args)...);
+
+        return dist;
+      }
+
+      template<class... MetaData>
+        requires std::is_copy_constructible_v<edge_type> && (std::is_same_v<MetaData, edge_meta_data_type> && ...)
+      void sorted_reciprocal_join(const edge_index_type node1, const edge_index_type pos1, const edge_index_type node2, MetaData... md)
+      {
+        graph_impl::join_sentinel sentinel{m_Edges, node1, pos1};
+        m_Edges.insert_to_partition(lower_bound_edge(node2, node1), node1, std::move(md)..., *(cbegin_edges(node1) + pos1));
+      }
+
       template<class... MetaData>
         requires std::is_copy_constructible_v<edge_type> && (std::is_same_v<MetaData, edge_meta_data_type> && ...)
       void reciprocal_join(const edge_index_type node1, const edge_index_type node2, MetaData... md)
@@ -32,6 +32,40 @@ namespace sequoia::maths
     constexpr static edge_sharing_preference edge_sharing{edge_sharing_preference::agnostic};
   };
 
+  /*! \brief Edge storage for which all allocations are made via a `std::pmr::memory_resource`
+      supplied to the graph's allocator-aware constructors.
+   */
+  struct pmr_contiguous_edge_storage_config
+  {
+    template <class T> using storage_type = data_structures::pmr::partitioned_sequence<T>;
+
+    constexpr static edge_sharing_preference edge_sharing{edge_sharing_preference::agnostic};
+  };
+
+  struct pmr_bucketed_edge_storage_config
+  {
+    template <class T> using storage_type = data_structures::pmr::bucketed_sequence<T>;
+
+    constexpr static edge_sharing_preference edge_sharing{edge_sharing_preference::agnostic};
+  };
+
+  /*! \brief Edge storage for which shared weights are held by an intrusively counted pointer.
+
+      Compared to the default `object::shared`, the count and weight live in a single allocation
+      and the partial edges are a pointer smaller. The count is not atomic, consistent with graphs
+      not being thread-safe. Configs may supply any handler satisfying `object::is_shared_handler_v`
+      via the member alias template `shared_weight_handler`; for example, `object::counted_shared<W, Resource>`
+      draws the weights from the memory resource returned by `Resource::get()`.
+   */
+  struct counted_weight_bucketed_edge_storage_config
+  {
+    template <class T> using storage_type = data_structures::bucketed_sequence<T>;
+
+    template <class W> using shared_weight_handler = object::counted_shared<W>;
+
+    constexpr static edge_sharing_preference edge_sharing{edge_sharing_preference::shared_weight};
+  };
+
 
   template<class Storage>
   concept allocatable_partitions = requires{
@@ -332,6 +366,7 @@ namespace sequoia::maths
     using base_type::erase_node;
 
     using base_type::join;
+    using base_type::join_unique;
     using base_type::erase_edge;
 
     using base_type::sort_edges;
@@ -389,6 +424,7 @@ namespace sequoia::maths
     using base_type::erase_node;
 
     using base_type::join;
+    using base_type::join_unique;
     using base_type::erase_edge;
 
     using base_type::sort_edges;
@@ -447,6 +483,7 @@ namespace sequoia::maths
     using base_type::erase_node;
 
     using base_type::join;
+    using base_type::join_unique;
 
     // TO DO: reinstate this, but implementation needs to be changed
     // using base_type::erase_edge;
@@ -502,6 +539,7 @@ namespace sequoia::maths
     using base_type::erase_node;
 
     using base_type::join;
+    using base_type::join_unique;
     using base_type::erase_edge;
 
     using base_type::primitive_type::insert_join;
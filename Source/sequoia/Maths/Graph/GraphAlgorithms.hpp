@@ -12,8 +12,18 @@
 
  */
 
+#include "sequoia/Core/Concurrency/ConcurrencyModels.hpp"
 #include "sequoia/Maths/Graph/DynamicGraph.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <limits>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
 namespace sequoia::maths
 {
   template<class G, class Pred>
@@ -37,4 +47,422 @@ namespace sequoia::maths
 
     return subGraph;
   }
+
+  template<class SizeType>
+  struct graph_components
+  {
+    using size_type = SizeType;
+
+    /// The component to which each node belongs
+    std::vector<size_type> component_of;
+
+    /// The number of nodes in each component
+    std::vector<size_type> component_sizes;
+
+    [[nodiscard]]
+    size_type num_components() const noexcept { return static_cast<size_type>(component_sizes.size()); }
+
+    [[nodiscard]]
+    friend bool operator==(const graph_components&, const graph_components&) noexcept = default;
+  };
+
+  /*! \brief Finds the strongly connected components of `g` in O(V + E), via an iterative form
+      of Tarjan's algorithm.
+
+      Components are numbered in reverse topological order of the condensation: if an edge leads
+      from one component to another, the latter has the lower number. For an undirected graph,
+      the strongly connected components are the connected components.
+   */
+  template<network G>
+  [[nodiscard]]
+  graph_components<typename G::size_type> strongly_connected_components(const G& g)
+  {
+    using size_type = typename G::size_type;
+    using edge_iterator = typename G::const_edge_iterator;
+    constexpr auto npos{std::numeric_limits<size_type>::max()};
+
+    graph_components<size_type> components{.component_of{std::vector<size_type>(g.order(), npos)}};
+    std::vector<size_type> index(g.order(), npos), lowLink(g.order()), stack{};
+    std::vector<bool> onStack(g.order());
+
+    struct frame
+    {
+      size_type node;
+      edge_iterator next;
+    };
+
+    std::vector<frame> frames{};
+    size_type count{};
+
+    auto discover{
+      [&](size_type n) {
+        index[n] = lowLink[n] = count++;
+        stack.push_back(n);
+        onStack[n] = true;
+        frames.push_back({n, g.cbegin_edges(n)});
+      }
+    };
+
+    for(size_type root{}; root < g.order(); ++root)
+    {
+      if(index[root] != npos) continue;
+
+      discover(root);
+      while(!frames.empty())
+      {
+        if(auto& f{frames.back()}; f.next != g.cend_edges(f.node))
+        {
+          const auto n{f.node}, target{(f.next++)->target_node()};
+          if(index[target] == npos)    discover(target);
+          else if(onStack[target])     lowLink[n] = std::min(lowLink[n], index[target]);
+        }
+        else
+        {
+          const auto n{f.node};
+          frames.pop_back();
+          if(!frames.empty())
+          {
+            const auto parent{frames.back().node};
+            lowLink[parent] = std::min(lowLink[parent], lowLink[n]);
+          }
+
+          if(lowLink[n] == index[n])
+          {
+            const auto label{components.num_components()};
+            components.component_sizes.push_back(0);
+
+            size_type member{};
+            do
+            {
+              member = stack.back();
+              stack.pop_back();
+              onStack[member] = false;
+              components.component_of[member] = label;
+              ++components.component_sizes.back();
+            } while(member != n);
+          }
+        }
+      }
+    }
+
+    return components;
+  }
+
+  /*! \brief Returns the nodes of `g` ordered such that every edge leads forwards, via Kahn's
+      algorithm, or std::nullopt if `g` contains a cycle.
+
+      Nodes without predecessors come first, in order of index; every other node follows in the
+      order in which its final predecessor is reached. The order is therefore not, in general,
+      that with the lowest available index first.
+   */
+  template<network G>
+    requires (is_directed(G::flavour))
+  [[nodiscard]]
+  std::optional<std::vector<typename G::size_type>> topological_sort(const G& g)
+  {
+    using size_type = typename G::size_type;
+
+    std::vector<size_type> inDegrees(g.order());
+    for(size_type n{}; n < g.order(); ++n)
+    {
+      for(auto i{g.cbegin_edges(n)}; i != g.cend_edges(n); ++i)
+        ++inDegrees[i->target_node()];
+    }
+
+    std::vector<size_type> order{};
+    order.reserve(g.order());
+    for(size_type n{}; n < g.order(); ++n)
+    {
+      if(!inDegrees[n]) order.push_back(n);
+    }
+
+    for(size_type pos{}; pos < order.size(); ++pos)
+    {
+      const auto n{order[pos]};
+      for(auto i{g.cbegin_edges(n)}; i != g.cend_edges(n); ++i)
+      {
+        if(!--inDegrees[i->target_node()]) order.push_back(i->target_node());
+      }
+    }
+
+    if(order.size() != g.order()) return std::nullopt;
+
+    return order;
+  }
+
+  /*! \brief Returns the nodes of a cycle of `g`, in the order in which they are traversed, or an
+      empty vector if `g` is acyclic; runs in O(V + E) without recursion.
+   */
+  template<network G>
+    requires (is_directed(G::flavour))
+  [[nodiscard]]
+  std::vector<typename G::size_type> find_cycle(const G& g)
+  {
+    using size_type = typename G::size_type;
+    using edge_iterator = typename G::const_edge_iterator;
+
+    enum class state : unsigned char { unvisited, active, finished };
+
+    struct frame
+    {
+      size_type node;
+      edge_iterator next;
+    };
+
+    std::vector<state> states(g.order(), state::unvisited);
+    std::vector<frame> frames{};
+
+    for(size_type root{}; root < g.order(); ++root)
+    {
+      if(states[root] != state::unvisited) continue;
+
+      states[root] = state::active;
+      frames.push_back({root, g.cbegin_edges(root)});
+      while(!frames.empty())
+      {
+        if(auto& f{frames.back()}; f.next != g.cend_edges(f.node))
+        {
+          const auto target{(f.next++)->target_node()};
+          if(states[target] == state::unvisited)
+          {
+            states[target] = state::active;
+            frames.push_back({target, g.cbegin_edges(target)});
+          }
+          else if(states[target] == state::active)
+          {
+            // The active nodes are precisely those on the stack, from the target to the top
+            auto first{std::ranges::find(frames, target, &frame::node)};
+            std::vector<size_type> cycle{};
+            for(; first != frames.end(); ++first) cycle.push_back(first->node);
+
+            return cycle;
+          }
+        }
+        else
+        {
+          states[f.node] = state::finished;
+          frames.pop_back();
+        }
+      }
+    }
+
+    return {};
+  }
+
+  /*! \brief A union-find structure whose `find` and `unite` may be called concurrently, without locks.
+
+      Each set is represented by its least element, to which every parent chain leads, since
+      roots are only ever linked beneath smaller roots. Paths are halved by `find`, a compare and
+      exchange ensuring that a concurrent link is never lost.
+
+      When used to track the components of a graph incrementally, `add_elements` should be called
+      as nodes are added and `unite` as edges are joined. Neither erasure of nodes nor removal of
+      edges is supported, since either may split a set.
+   */
+  template<class SizeType=std::size_t>
+  class concurrent_disjoint_sets
+  {
+  public:
+    using size_type = SizeType;
+
+    explicit concurrent_disjoint_sets(size_type n = 0) { add_elements(n); }
+
+    concurrent_disjoint_sets(const concurrent_disjoint_sets&) = delete;
+    concurrent_disjoint_sets(concurrent_disjoint_sets&&) noexcept = default;
+
+    concurrent_disjoint_sets& operator=(const concurrent_disjoint_sets&) = delete;
+    concurrent_disjoint_sets& operator=(concurrent_disjoint_sets&&) noexcept = default;
+
+    [[nodiscard]]
+    size_type size() const noexcept { return m_Size; }
+
+    /// Adds singleton sets; must not be called concurrently with any other member function
+    void add_elements(size_type n)
+    {
+      if(m_Size + n > m_Capacity)
+      {
+        const auto capacity{std::max(m_Size + n, 2 * m_Capacity)};
+        auto parents{std::make_unique<std::atomic<size_type>[]>(capacity)};
+        for(size_type i{}; i < m_Size; ++i)
+          parents[i].store(m_Parents[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        m_Parents  = std::move(parents);
+        m_Capacity = capacity;
+      }
+
+      for(size_type i{m_Size}; i < m_Size + n; ++i)
+        m_Parents[i].store(i, std::memory_order_relaxed);
+
+      m_Size += n;
+    }
+
+    [[nodiscard]]
+    size_type find(size_type x) noexcept
+    {
+      while(true)
+      {
+        auto parent{m_Parents[x].load(std::memory_order_acquire)};
+        if(parent == x) return x;
+
+        const auto grandParent{m_Parents[parent].load(std::memory_order_acquire)};
+        if(grandParent != parent)
+          m_Parents[x].compare_exchange_weak(parent, grandParent, std::memory_order_acq_rel, std::memory_order_relaxed);
+
+        x = grandParent;
+      }
+    }
+
+    /// Returns true if `a` and `b` were previously in different sets
+    bool unite(size_type a, size_type b) noexcept
+    {
+      while(true)
+      {
+        a = find(a);
+        b = find(b);
+        if(a == b) return false;
+
+        if(a < b) std::swap(a, b);
+        if(auto expected{a}; m_Parents[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel, std::memory_order_relaxed))
+          return true;
+      }
+    }
+
+    [[nodiscard]]
+    bool same_set(size_type a, size_type b) noexcept { return find(a) == find(b); }
+
+    /*! \brief Labels the sets in order of their least elements; must not be called concurrently with `unite` */
+    [[nodiscard]]
+    graph_components<size_type> components()
+    {
+      graph_components<size_type> c{.component_of{std::vector<size_type>(m_Size)}};
+      for(size_type x{}; x < m_Size; ++x)
+      {
+        // A root is the least element of its set, and so is labelled before any other member
+        if(const auto root{find(x)}; root == x)
+        {
+          c.component_of[x] = c.num_components();
+          c.component_sizes.push_back(1);
+        }
+        else
+        {
+          c.component_of[x] = c.component_of[root];
+          ++c.component_sizes[c.component_of[x]];
+        }
+      }
+
+      return c;
+    }
+  private:
+    std::unique_ptr<std::atomic<size_type>[]> m_Parents{};
+    size_type m_Size{}, m_Capacity{};
+  };
+
+  namespace graph_impl
+  {
+    /// Pushes consecutive blocks of [0, n) to the model and waits for all of them to complete
+    template<class Model, class SizeType, class Fn>
+    void for_each_block(Model& model, SizeType n, Fn fn)
+    {
+      constexpr SizeType blockSize{1 << 14};
+      if constexpr(std::same_as<Model, concurrency::serial<void>>)
+      {
+        fn(SizeType{}, n);
+      }
+      else
+      {
+        std::vector<std::future<void>> futures{};
+        for(SizeType first{}; first < n; first += blockSize)
+        {
+          const auto last{std::min(n, first + blockSize)};
+          futures.push_back(model.push([&fn, first, last]() { fn(first, last); }));
+        }
+
+        for(auto& f : futures) f.get();
+      }
+    }
+  }
+
+  /*! \brief Finds the connected components of an undirected graph, labelled in order of their
+      lowest-indexed nodes, using `model` to process blocks of nodes concurrently.
+
+      Follows the Afforest scheme: nodes are first linked to a couple of their neighbours, after
+      which a sample of the nodes is used to guess the largest component. The remaining edges of
+      nodes in this component are skipped, which is safe since every edge of an undirected graph
+      is also visible from its other end.
+   */
+  template<network G, class Model>
+    requires (!is_directed(G::flavour))
+  [[nodiscard]]
+  graph_components<typename G::size_type> connected_components(const G& g, Model& model)
+  {
+    using size_type       = typename G::size_type;
+    using difference_type = std::iter_difference_t<typename G::const_edge_iterator>;
+    constexpr static size_type neighbourRounds{2}, numSamples{1024};
+
+    concurrent_disjoint_sets<size_type> sets{g.order()};
+    const auto degree{
+      [&g](size_type n) { return static_cast<size_type>(std::ranges::distance(g.cbegin_edges(n), g.cend_edges(n))); }
+    };
+
+    for(size_type round{}; round < neighbourRounds; ++round)
+    {
+      graph_impl::for_each_block(model, g.order(), [&g, &sets, &degree, round](size_type first, size_type last) {
+        for(auto n{first}; n < last; ++n)
+        {
+          if(round < degree(n))
+            sets.unite(n, std::ranges::next(g.cbegin_edges(n), static_cast<difference_type>(round))->target_node());
+        }
+      });
+    }
+
+    graph_impl::for_each_block(model, g.order(), [&sets](size_type first, size_type last) {
+      for(auto n{first}; n < last; ++n) (void)sets.find(n);
+    });
+
+    size_type largest{std::numeric_limits<size_type>::max()};
+    if(g.order())
+    {
+      std::minstd_rand gen{};
+      std::uniform_int_distribution<size_type> dist{0, g.order() - 1};
+      std::unordered_map<size_type, size_type> counts{};
+      size_type maxCount{};
+      for(size_type i{}; i < numSamples; ++i)
+      {
+        const auto root{sets.find(dist(gen))};
+        if(const auto c{++counts[root]}; c > maxCount)
+        {
+          maxCount = c;
+          largest  = root;
+        }
+      }
+    }
+
+    graph_impl::for_each_block(model, g.order(), [&g, &sets, &degree, largest](size_type first, size_type last) {
+      for(auto n{first}; n < last; ++n)
+      {
+        if(sets.find(n) == largest) continue;
+
+        for(auto i{std::ranges::next(g.cbegin_edges(n), static_cast<difference_type>(std::min(neighbourRounds, degree(n))))}; i != g.cend_edges(n); ++i)
+          sets.unite(n, i->target_node());
+      }
+    });
+
+    return sets.components();
+  }
+
+  /*! \brief Finds the connected components on a pool of `numThreads` threads, or serially if `numThreads` is zero */
+  template<network G>
+    requires (!is_directed(G::flavour))
+  [[nodiscard]]
+  graph_components<typename G::size_type> connected_components(const G& g, std::size_t numThreads)
+  {
+    if(!numThreads)
+    {
+      concurrency::serial<void> model{};
+      return connected_components(g, model);
+    }
+
+    concurrency::thread_pool<void> pool{numThreads};
+    return connected_components(g, pool);
+  }
 }
@@ -63,7 +63,7 @@ namespace sequoia
           typename Edge::weight_handler_type;
           typename Edge::weight_type;
 
-          requires std::is_same_v<object::shared<typename Edge::weight_type>, typename Edge::weight_handler_type>;
+          requires object::is_shared_handler_v<typename Edge::weight_handler_type>;
         }
       };
 
@@ -73,8 +73,29 @@ namespace sequoia
         return (flavour != graph_flavour::directed) ? 2*size : size;
       }
 
-      template<bool Shared, class Weight>
-      using shared_to_handler_t = std::conditional_t<Shared, object::shared<Weight>, object::by_value<Weight>>;
+      /*! \brief By default, shared weights are handled by object::shared; however, an edge storage
+          config may specify an alternative via a member alias template `shared_weight_handler`.
+       */
+      template<class EdgeStorageConfig, class Weight>
+      struct shared_weight_handler_generator
+      {
+        using type = object::shared<Weight>;
+      };
+
+      template<class EdgeStorageConfig, class Weight>
+        requires requires { typename EdgeStorageConfig::template shared_weight_handler<Weight>; }
+      struct shared_weight_handler_generator<EdgeStorageConfig, Weight>
+      {
+        using type = typename EdgeStorageConfig::template shared_weight_handler<Weight>;
+
+        static_assert(object::is_shared_handler_v<type>);
+      };
+
+      template<bool Shared, class Weight, class EdgeStorageConfig=void>
+      using shared_to_handler_t
+        = std::conditional_t<Shared,
+                             typename shared_weight_handler_generator<EdgeStorageConfig, Weight>::type,
+                             object::by_value<Weight>>;
 
       template<class Weight>
       [[nodiscard]]
@@ -128,7 +149,7 @@ namespace sequoia
         static_assert(!shared_weight_v || (GraphFlavour != graph_flavour::directed));
         static_assert((GraphFlavour == graph_flavour::directed) || std::is_empty_v<EdgeMetaData> || std::is_empty_v<EdgeWeight> || shared_weight_v);
 
-        using handler_type = shared_to_handler_t<shared_weight_v, EdgeWeight>;
+        using handler_type = shared_to_handler_t<shared_weight_v, EdgeWeight, EdgeStorageConfig>;
         using edge_type    = flavour_to_edge_t<GraphFlavour, handler_type, EdgeMetaData, IndexType>;
         using storage_type = EdgeStorageConfig::template storage_type<edge_type>;
       };
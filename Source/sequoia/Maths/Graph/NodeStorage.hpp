@@ -22,6 +22,7 @@
 
 #include <type_traits>
 #include <algorithm>
+#include <memory_resource>
 
 namespace sequoia::maths
 {
@@ -293,6 +294,9 @@ namespace sequoia::maths
     {}
   };
 
+  template<class Weight>
+  using pmr_node_storage = node_storage<Weight, std::pmr::vector<Weight>>;
+
   template<class Weight, class Container>
     requires std::is_empty_v<Weight>
   class node_storage<Weight, Container>
@@ -0,0 +1,322 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Dependency-aware execution of a directed acyclic graph, whose node weights are tasks.
+
+    An edge from `u` to `v` indicates that the task at `v` depends on the task at `u`. Each node
+    tracks the number of its predecessors which are yet to complete; once this drops to zero, the
+    node's task is immediately pushed to the concurrency model. There is no barrier between
+    successive levels of the graph, so a task runs as soon as its own dependencies are satisfied.
+ */
+
+#include "sequoia/Core/Concurrency/ConcurrencyModels.hpp"
+#include "sequoia/Maths/Graph/GraphDetails.hpp"
+#include "sequoia/Maths/Graph/GraphTraits.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace sequoia::maths
+{
+  template<class G>
+  concept task_graph = network<G> && is_directed(G::flavour) && std::invocable<const typename G::node_weight_type&>;
+
+  struct task_timing
+  {
+    using clock_type = std::chrono::steady_clock;
+    using duration   = clock_type::duration;
+
+    clock_type::time_point start{}, finish{};
+
+    [[nodiscard]]
+    duration elapsed() const noexcept { return finish - start; }
+  };
+
+  template<class SizeType>
+  struct task_graph_report
+  {
+    using size_type = SizeType;
+
+    /// Indexed by node
+    std::vector<task_timing> timings;
+
+    /// The chain of dependent tasks whose durations sum to the greatest total, from first to last
+    std::vector<size_type> critical_path;
+
+    task_timing::duration critical_path_length{};
+  };
+
+  namespace graph_impl
+  {
+    /*! \brief Returns the number of predecessors of each node, throwing if the graph contains a cycle */
+    template<task_graph G>
+    [[nodiscard]]
+    std::vector<typename G::size_type> in_degrees_of_acyclic(const G& g, std::vector<typename G::size_type>& topologicalOrder)
+    {
+      using size_type = typename G::size_type;
+
+      std::vector<size_type> inDegrees(g.order());
+      for(size_type n{}; n < g.order(); ++n)
+      {
+        for(auto i{g.cbegin_edges(n)}; i != g.cend_edges(n); ++i)
+          ++inDegrees[i->target_node()];
+      }
+
+      auto remaining{inDegrees};
+      topologicalOrder.clear();
+      topologicalOrder.reserve(g.order());
+      for(size_type n{}; n < g.order(); ++n)
+      {
+        if(!remaining[n]) topologicalOrder.push_back(n);
+      }
+
+      for(size_type pos{}; pos < topologicalOrder.size(); ++pos)
+      {
+        const auto n{topologicalOrder[pos]};
+        for(auto i{g.cbegin_edges(n)}; i != g.cend_edges(n); ++i)
+        {
+          if(!--remaining[i->target_node()]) topologicalOrder.push_back(i->target_node());
+        }
+      }
+
+      if(topologicalOrder.size() != g.order())
+        throw std::logic_error{"execute_task_graph: graph contains a cycle"};
+
+      return inDegrees;
+    }
+
+    template<class SizeType>
+    void find_critical_path(task_graph_report<SizeType>& report, const auto& g, const std::vector<SizeType>& topologicalOrder)
+    {
+      using size_type = SizeType;
+      using duration  = task_timing::duration;
+
+      constexpr auto npos{std::numeric_limits<size_type>::max()};
+      std::vector<duration> longest(g.order());
+      std::vector<size_type> previous(g.order(), npos);
+
+      for(const auto n : topologicalOrder)
+      {
+        longest[n] += report.timings[n].elapsed();
+        for(auto i{g.cbegin_edges(n)}; i != g.cend_edges(n); ++i)
+        {
+          if(const auto target{i->target_node()}; longest[n] > longest[target])
+          {
+            longest[target]  = longest[n];
+            previous[target] = n;
+          }
+        }
+      }
+
+      if(const auto last{std::ranges::max_element(longest)}; last != longest.end())
+      {
+        report.critical_path_length = *last;
+        for(auto n{static_cast<size_type>(std::ranges::distance(longest.begin(), last))}; n != npos; n = previous[n])
+          report.critical_path.push_back(n);
+
+        std::ranges::reverse(report.critical_path);
+      }
+    }
+
+    template<class Model>
+    inline constexpr bool is_serial_v{false};
+
+    template<class R>
+    inline constexpr bool is_serial_v<concurrency::serial<R>>{true};
+
+    template<class SizeType>
+    struct task_graph_state
+    {
+      using size_type = SizeType;
+
+      explicit task_graph_state(const std::vector<size_type>& inDegrees)
+        : remaining(inDegrees.size())
+        , cancelled(inDegrees.size())
+        , timings(inDegrees.size())
+      {
+        for(std::size_t i{}; i < inDegrees.size(); ++i)
+          remaining[i].store(inDegrees[i], std::memory_order_relaxed);
+      }
+
+      void fail(size_type node, std::exception_ptr e)
+      {
+        cancelled[node] = true;
+        std::scoped_lock lock{error_mutex};
+        if(!error) error = std::move(e);
+      }
+
+      std::vector<std::atomic<size_type>> remaining;
+      std::vector<std::atomic<bool>> cancelled;
+      std::vector<task_timing> timings;
+      std::atomic<size_type> completed{};
+      std::mutex error_mutex{};
+      std::exception_ptr error{};
+      std::promise<void> done{};
+
+      /// Nodes awaiting a serial model, which are drained iteratively rather than recursively
+      std::vector<size_type> ready{};
+      bool draining{};
+    };
+
+    /*! \brief Pushes the task at a node to the model; on completion, the task schedules each successor
+        for which it was the final outstanding predecessor.
+
+        The state is shared with every task, since the final task may still be unwinding after
+        the graph's completion has been signalled.
+
+        A serial model executes each task within `push`. Scheduling successors from within the task
+        would therefore nest one call per node along a chain of dependencies, so instead ready nodes
+        are queued and drained by the outermost call.
+
+        If `push` throws, the node is retired on the calling thread, as though its task had thrown
+        the same exception. This ensures that every node is accounted for, and so completion is
+        always signalled.
+     */
+    template<task_graph G, class Model>
+    struct task_scheduler
+    {
+      using size_type  = typename G::size_type;
+      using state_type = task_graph_state<size_type>;
+
+      const G* graph;
+      Model* model;
+
+      void operator()(const std::shared_ptr<state_type>& pState, size_type node) const
+      {
+        if constexpr(is_serial_v<Model>)
+        {
+          auto& st{*pState};
+          st.ready.push_back(node);
+          if(st.draining) return;
+
+          st.draining = true;
+          while(!st.ready.empty())
+          {
+            const auto next{st.ready.back()};
+            st.ready.pop_back();
+            dispatch(pState, next);
+          }
+          st.draining = false;
+        }
+        else
+        {
+          dispatch(pState, node);
+        }
+      }
+    private:
+      void dispatch(const std::shared_ptr<state_type>& pState, size_type node) const
+      {
+        try
+        {
+          (void)model->push([scheduler{*this}, pState, node]() { scheduler.run(pState, node); });
+        }
+        catch(...)
+        {
+          pState->fail(node, std::current_exception());
+          run(pState, node);
+        }
+      }
+
+      void run(const std::shared_ptr<state_type>& pState, size_type node) const
+      {
+        auto& st{*pState};
+        const G& g{*graph};
+
+        if(!st.cancelled[node])
+        {
+          st.timings[node].start = task_timing::clock_type::now();
+          try
+          {
+            std::invoke(*(g.cbegin_node_weights() + node));
+          }
+          catch(...)
+          {
+            st.fail(node, std::current_exception());
+          }
+          st.timings[node].finish = task_timing::clock_type::now();
+        }
+
+        for(auto i{g.cbegin_edges(node)}; i != g.cend_edges(node); ++i)
+        {
+          const auto target{i->target_node()};
+          if(st.cancelled[node]) st.cancelled[target] = true;
+          if(st.remaining[target].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            (*this)(pState, target);
+        }
+
+        if(st.completed.fetch_add(1, std::memory_order_acq_rel) + 1 == g.order())
+          st.done.set_value();
+      }
+    };
+  }
+
+  /*! \brief Executes the task at each node of `g` once all of its predecessors have completed.
+
+      The model's `push` must not block on the completion of the task pushed; this holds both for
+      concurrency::thread_pool and for concurrency::serial, the latter executing the entire graph
+      on the calling thread. Throws std::logic_error if `g` contains a cycle. If a task throws, or
+      cannot be pushed to the model, its descendants are not executed and, once all other tasks have
+      finished, the first exception is rethrown.
+   */
+  template<task_graph G, class Model>
+  task_graph_report<typename G::size_type> execute_task_graph(const G& g, Model& model)
+  {
+    using size_type = typename G::size_type;
+
+    std::vector<size_type> topologicalOrder{};
+    const auto inDegrees{graph_impl::in_degrees_of_acyclic(g, topologicalOrder)};
+    if(!g.order()) return {};
+
+    const auto pState{std::make_shared<graph_impl::task_graph_state<size_type>>(inDegrees)};
+    auto finished{pState->done.get_future()};
+
+    // Roots are identified before any are scheduled since, for a serial model, the first push executes the entire graph
+    std::vector<size_type> roots{};
+    for(size_type n{}; n < g.order(); ++n)
+    {
+      if(!inDegrees[n]) roots.push_back(n);
+    }
+
+    const graph_impl::task_scheduler<G, Model> schedule{&g, &model};
+    for(const auto n : roots)
+      schedule(pState, n);
+
+    finished.get();
+    if(pState->error) std::rethrow_exception(pState->error);
+
+    task_graph_report<size_type> report{.timings{std::move(pState->timings)}};
+    graph_impl::find_critical_path(report, g, topologicalOrder);
+
+    return report;
+  }
+
+  /*! \brief Executes the task graph on a pool of `numThreads` threads, or serially if `numThreads` is zero */
+  template<task_graph G>
+  task_graph_report<typename G::size_type> execute_task_graph(const G& g, std::size_t numThreads)
+  {
+    if(!numThreads)
+    {
+      concurrency::serial<void> model{};
+      return execute_task_graph(g, model);
+    }
+
+    concurrency::thread_pool<void> pool{numThreads};
+    return execute_task_graph(g, pool);
+  }
+}
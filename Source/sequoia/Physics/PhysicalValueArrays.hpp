@@ -0,0 +1,292 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/** @file
+    @brief Contiguous, structure-of-arrays containers of physical values.
+
+    A physical_value validates each value upon construction and every arithmetic operation
+    returns a new, validated object. For bulk processing this is wasteful. The containers
+    in this file hold the components of many physical values in separate, contiguous
+    arrays, retaining the space, units and validator in the type. Element-wise arithmetic
+    and unit conversion act directly on the raw components and the result is validated
+    once per batch, using maths::validate_batch.
+
+    The type of the result of any element-wise operation is precisely the type which
+    would be obtained by performing the operation on the individual physical values.
+ */
+
+#include "sequoia/Physics/PhysicalValues.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace sequoia::physics
+{
+  template<class T>
+  struct is_physical_value : std::false_type {};
+
+  template<convex_space ValueSpace, physical_unit Unit, basis_for<free_module_type_of_t<ValueSpace>> Basis, class Origin, validator_for<ValueSpace> Validator>
+  struct is_physical_value<physical_value<ValueSpace, Unit, Basis, Origin, Validator>> : std::true_type {};
+
+  template<class T>
+  using is_physical_value_t = is_physical_value<T>::type;
+
+  template<class T>
+  inline constexpr bool is_physical_value_v{is_physical_value<T>::value};
+
+  /** @brief Structure-of-arrays container for physical values.
+
+      Each of the D components is stored in its own contiguous array. Elements are
+      returned by value, since they are not stored as such; however, the components
+      may be accessed directly as spans.
+   */
+  template<class PhysicalValue>
+    requires is_physical_value_v<PhysicalValue>
+  class physical_value_array
+  {
+  public:
+    using element_type   = PhysicalValue;
+    using value_type     = element_type::value_type;
+    using units_type     = element_type::units_type;
+    using space_type     = element_type::space_type;
+    using validator_type = element_type::validator_type;
+    using size_type      = std::size_t;
+
+    constexpr static std::size_t dimension{element_type::dimension};
+    constexpr static std::size_t D{dimension};
+
+    physical_value_array() = default;
+
+    /// For D > 1, the values are supplied component by component: all the x values, then all the y values, etc.
+    physical_value_array(std::span<const value_type> values, units_type)
+    {
+      if(values.size() % D)
+        throw std::logic_error{std::format("physical_value_array: number of values, {}, is not a multiple of the dimension, {}", values.size(), D)};
+
+      const auto n{values.size() / D};
+      for(std::size_t i{}; i < D; ++i)
+        m_Components[i].assign(values.begin() + i * n, values.begin() + (i + 1) * n);
+
+      validate();
+    }
+
+    physical_value_array(std::array<std::vector<value_type>, D> components, units_type)
+      : m_Components{std::move(components)}
+    {
+      if(!std::ranges::all_of(m_Components, [n{size()}](const auto& c) { return c.size() == n; }))
+        throw std::logic_error{"physical_value_array: components must all be of the same size"};
+
+      validate();
+    }
+
+    physical_value_array(std::initializer_list<element_type> elements)
+    {
+      reserve(elements.size());
+      for(const auto& e : elements)
+        push_back(e);
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept { return m_Components.front().size(); }
+
+    [[nodiscard]]
+    bool empty() const noexcept { return m_Components.front().empty(); }
+
+    void reserve(size_type n)
+    {
+      for(auto& c : m_Components) c.reserve(n);
+    }
+
+    void clear() noexcept
+    {
+      for(auto& c : m_Components) c.clear();
+    }
+
+    /// Elements are already valid and so no validation is required
+    void push_back(const element_type& e)
+    {
+      for(std::size_t i{}; i < D; ++i)
+        m_Components[i].push_back(e.values()[i]);
+    }
+
+    [[nodiscard]]
+    element_type operator[](size_type k) const
+    {
+      if constexpr(D == 1)
+      {
+        return {m_Components.front()[k], units_type{}};
+      }
+      else
+      {
+        return [&, this] <std::size_t... Is>(std::index_sequence<Is...>) {
+          return element_type{std::array{m_Components[Is][k]...}, units_type{}};
+        }(std::make_index_sequence<D>{});
+      }
+    }
+
+    [[nodiscard]]
+    std::span<const value_type> component(std::size_t i) const noexcept { return m_Components[i]; }
+
+    [[nodiscard]]
+    std::span<const value_type> values() const noexcept requires (D == 1) { return m_Components.front(); }
+
+    template<class OtherUnit>
+      requires physical_unit<OtherUnit> && requires(const element_type& e) { e.convert_to(OtherUnit{}); }
+    [[nodiscard]]
+    auto convert_to(OtherUnit) const
+    {
+      using converted_type = decltype(std::declval<const element_type&>().convert_to(OtherUnit{}));
+      if constexpr(std::is_same_v<converted_type, element_type>)
+      {
+        return *this;
+      }
+      else
+      {
+        using transformation_type = coordinate_transformation<element_type, converted_type>;
+        using ratio_type          = transformation_type::transform_type::dilatation_type::ratio_type;
+
+        return transform<converted_type>(
+          size(),
+          [this](std::size_t i, std::size_t k) {
+            return static_cast<value_type>((m_Components[i][k] * ratio_type::num / ratio_type::den) + transformation_type::to_displacement());
+          }
+        );
+      }
+    }
+
+    [[nodiscard]]
+    friend bool operator==(const physical_value_array&, const physical_value_array&) = default;
+
+    template<class U>
+      requires requires (const element_type& t, const U& u) { t + u; }
+    [[nodiscard]]
+    friend auto operator+(const physical_value_array& lhs, const physical_value_array<U>& rhs)
+    {
+      return combine(lhs, rhs, [](const auto& l, const auto& r) { return l + r; });
+    }
+
+    template<class U>
+      requires requires (const element_type& t, const U& u) { t - u; }
+    [[nodiscard]]
+    friend auto operator-(const physical_value_array& lhs, const physical_value_array<U>& rhs)
+    {
+      return combine(lhs, rhs, [](const auto& l, const auto& r) { return l - r; });
+    }
+
+    template<class U>
+      requires requires (const element_type& t, const U& u) { t * u; }
+    [[nodiscard]]
+    friend auto operator*(const physical_value_array& lhs, const physical_value_array<U>& rhs)
+    {
+      return combine(lhs, rhs, [](const auto& l, const auto& r) { return l * r; });
+    }
+
+    template<class U>
+      requires requires (const element_type& t, const U& u) { t / u; }
+    [[nodiscard]]
+    friend auto operator/(const physical_value_array& lhs, const physical_value_array<U>& rhs)
+    {
+      return combine(lhs, rhs, [](const auto& l, const auto& r) { return l / r; });
+    }
+
+    [[nodiscard]]
+    friend auto operator*(const physical_value_array& lhs, value_type u)
+      requires requires (const element_type& t, value_type v) { t * v; }
+    {
+      using result_type = decltype(std::declval<const element_type&>() * u);
+      return transform<result_type>(lhs.size(), [&](std::size_t i, std::size_t k) { return lhs.m_Components[i][k] * u; });
+    }
+
+    [[nodiscard]]
+    friend auto operator*(value_type u, const physical_value_array& rhs)
+      requires requires (const element_type& t, value_type v) { t * v; }
+    {
+      return rhs * u;
+    }
+
+    [[nodiscard]]
+    friend auto operator/(const physical_value_array& lhs, value_type u)
+      requires requires (const element_type& t, value_type v) { t / v; }
+    {
+      using result_type = decltype(std::declval<const element_type&>() / u);
+      return transform<result_type>(lhs.size(), [&](std::size_t i, std::size_t k) { return lhs.m_Components[i][k] / u; });
+    }
+  private:
+    template<class T>
+      requires is_physical_value_v<T>
+    friend class physical_value_array;
+
+    std::array<std::vector<value_type>, D> m_Components{};
+
+    void validate()
+    {
+      validator_type validator{};
+      if constexpr(D == 1)
+      {
+        maths::validate_batch(validator, std::span<value_type>{m_Components.front()});
+      }
+      else if constexpr(!defines_identity_validator_v<validator_type>)
+      {
+        for(std::size_t k{}; k < size(); ++k)
+        {
+          [&, this] <std::size_t... Is>(std::index_sequence<Is...>) {
+            const std::array<value_type, D> validated{validator(std::array{m_Components[Is][k]...})};
+            ((m_Components[Is][k] = validated[Is]), ...);
+          }(std::make_index_sequence<D>{});
+        }
+      }
+    }
+
+    /// Populates an array of size n, with component i of element k given by fn(i, k), and validates it in a single batch
+    template<class Result, class Fn>
+      requires is_physical_value_v<Result> && std::invocable<Fn, std::size_t, std::size_t>
+    [[nodiscard]]
+    static physical_value_array<Result> transform(size_type n, Fn fn)
+    {
+      physical_value_array<Result> result{};
+      for(std::size_t i{}; i < Result::dimension; ++i)
+      {
+        auto& c{result.m_Components[i]};
+        c.resize(n);
+        for(std::size_t k{}; k < n; ++k)
+          c[k] = fn(i, k);
+      }
+
+      result.validate();
+      return result;
+    }
+
+    /// Components of one-dimensional operands are broadcast against those of higher dimensional operands
+    template<class T>
+    [[nodiscard]]
+    static auto component_of(const physical_value_array<T>& a, std::size_t i, std::size_t k)
+    {
+      return a.m_Components[T::dimension == 1 ? 0 : i][k];
+    }
+
+    template<class U, class Op>
+    [[nodiscard]]
+    static auto combine(const physical_value_array& lhs, const physical_value_array<U>& rhs, Op op)
+    {
+      using result_type = std::remove_cvref_t<std::invoke_result_t<Op, const element_type&, const U&>>;
+
+      if(lhs.size() != rhs.size())
+        throw std::logic_error{std::format("physical_value_array: size mismatch, {} vs {}", lhs.size(), rhs.size())};
+
+      return transform<result_type>(
+        lhs.size(),
+        [&](std::size_t i, std::size_t k) { return op(component_of(lhs, i, k), component_of(rhs, i, k)); }
+      );
+    }
+  };
+
+  template<physical_unit Unit, class Rep, class Validator=typename Unit::validator_type>
+    requires has_default_space_v<Unit, Rep>
+  using quantity_array = physical_value_array<quantity<Unit, Rep, Validator>>;
+}
@@ -0,0 +1,400 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/** @file
+    @brief Lazy evaluation of chained arithmetic on physical values and arrays thereof.
+
+    Each arithmetic operation on a physical_value materializes a new, validated object. For
+    an expression such as `(m1 + m2) * k / t`, this means several temporaries and several
+    validations. Wrapping any operand with `lazy` instead builds an expression whose type
+    encodes the operations; the result type, including its space and units, is deduced at
+    compile time from the corresponding operations on physical values. A call to `evaluate`
+    then computes the raw values in a single pass and validates only the final result.
+
+    Intermediate results are validated only where the algebra does not guarantee their
+    validity. For example, the sum of two values on a half-line remains on the half-line,
+    whereas the product of such a value with a bare number need not. In this way, a lazily
+    evaluated expression throws precisely when the eagerly evaluated equivalent would.
+
+    If any operand is a physical_value_array, the expression is evaluated element-wise,
+    with any single physical values or numbers broadcast, and the result is validated as
+    a single batch. Arrays are held by reference; consequently, an expression must not
+    outlive any array from which it is built, and composing a temporary array is rejected.
+ */
+
+#include "sequoia/Physics/PhysicalValueArrays.hpp"
+
+#include <functional>
+#include <optional>
+
+namespace sequoia::physics
+{
+  namespace impl
+  {
+    template<class T>
+    struct operand_traits
+    {
+      using value_type     = T;
+      using validator_type = std::identity;
+      constexpr static std::size_t dimension{1};
+      constexpr static bool is_physical{};
+    };
+
+    template<class T>
+      requires is_physical_value_v<T>
+    struct operand_traits<T>
+    {
+      using value_type     = T::value_type;
+      using validator_type = T::validator_type;
+      constexpr static std::size_t dimension{T::dimension};
+      constexpr static bool is_physical{true};
+    };
+
+    template<class T>
+    inline constexpr bool has_half_line_validator_v{
+      operand_traits<T>::is_physical && defines_half_line_validator_v<typename operand_traits<T>::validator_type>
+    };
+
+    template<class T>
+    inline constexpr bool has_trivial_validator_v{
+      defines_identity_validator_v<typename operand_traits<T>::validator_type>
+    };
+
+    template<class Validator, class T, std::size_t D>
+    [[nodiscard]]
+    constexpr std::array<T, D> validate(const std::array<T, D>& values)
+    {
+      Validator validator{};
+      if constexpr(requires { validator(values); })
+        return validator(values);
+      else
+        return {validator(values.front())};
+    }
+  }
+
+  template<class T>
+  struct is_physical_expression : std::false_type {};
+
+  template<class T>
+  using is_physical_expression_t = is_physical_expression<T>::type;
+
+  template<class T>
+  inline constexpr bool is_physical_expression_v{is_physical_expression<T>::value};
+
+  template<class T>
+  concept physical_expression = is_physical_expression_v<std::remove_cvref_t<T>>;
+
+  /** @brief Leaf holding a single physical value or a number, which is broadcast if the expression is bulk */
+  template<class T>
+    requires is_physical_value_v<T> || arithmetic<T>
+  class value_expression
+  {
+  public:
+    using result_type = T;
+    using value_type  = impl::operand_traits<T>::value_type;
+
+    constexpr static std::size_t dimension{impl::operand_traits<T>::dimension};
+    constexpr static bool is_bulk{};
+
+    constexpr explicit value_expression(const T& t) : m_Value{t} {}
+
+    [[nodiscard]]
+    constexpr std::optional<std::size_t> size() const noexcept { return std::nullopt; }
+
+    [[nodiscard]]
+    constexpr std::array<value_type, dimension> values(std::size_t) const noexcept
+    {
+      if constexpr(impl::operand_traits<T>::is_physical)
+        return utilities::to_array(m_Value.values());
+      else
+        return {m_Value};
+    }
+
+    [[nodiscard]]
+    constexpr std::array<value_type, dimension> raw_values(std::size_t k) const noexcept { return values(k); }
+  private:
+    T m_Value;
+  };
+
+  /** @brief Leaf referring to a physical_value_array */
+  template<class PhysicalValue>
+  class array_expression
+  {
+  public:
+    using result_type = PhysicalValue;
+    using value_type  = PhysicalValue::value_type;
+
+    constexpr static std::size_t dimension{PhysicalValue::dimension};
+    constexpr static bool is_bulk{true};
+
+    constexpr explicit array_expression(const physical_value_array<PhysicalValue>& a) noexcept : m_pArray{&a} {}
+
+    [[nodiscard]]
+    std::optional<std::size_t> size() const noexcept { return m_pArray->size(); }
+
+    [[nodiscard]]
+    std::array<value_type, dimension> values(std::size_t k) const noexcept
+    {
+      return [&, this] <std::size_t... Is>(std::index_sequence<Is...>) {
+        return std::array<value_type, dimension>{m_pArray->component(Is)[k]...};
+      }(std::make_index_sequence<dimension>{});
+    }
+
+    [[nodiscard]]
+    std::array<value_type, dimension> raw_values(std::size_t k) const noexcept { return values(k); }
+  private:
+    const physical_value_array<PhysicalValue>* m_pArray;
+  };
+
+  /** @brief Node representing the lazy application of a binary operation.
+
+      The result type is that which is obtained by applying Op to the result types of the
+      operands. Operands of dimension 1 are broadcast against those of higher dimension.
+   */
+  template<class Op, class LHS, class RHS>
+    requires requires (const typename LHS::result_type& l, const typename RHS::result_type& r) { Op{}(l, r); }
+  class binary_expression
+  {
+  public:
+    using lhs_result_type = LHS::result_type;
+    using rhs_result_type = RHS::result_type;
+    using result_type     = std::remove_cvref_t<std::invoke_result_t<Op, const lhs_result_type&, const rhs_result_type&>>;
+    using value_type      = impl::operand_traits<result_type>::value_type;
+    using validator_type  = impl::operand_traits<result_type>::validator_type;
+
+    constexpr static std::size_t dimension{impl::operand_traits<result_type>::dimension};
+    constexpr static bool is_bulk{LHS::is_bulk || RHS::is_bulk};
+
+    /// Whether validity of the operands implies validity of the result, obviating the need for its validation
+    constexpr static bool preserves_validity{
+         impl::has_trivial_validator_v<result_type>
+      || (std::is_same_v<Op, std::plus<>> && impl::has_half_line_validator_v<lhs_result_type> && impl::has_half_line_validator_v<rhs_result_type>)
+      || (    (std::is_same_v<Op, std::multiplies<>> || std::is_same_v<Op, std::divides<>>)
+           && (impl::has_half_line_validator_v<lhs_result_type> || (impl::operand_traits<lhs_result_type>::is_physical && impl::has_trivial_validator_v<lhs_result_type>))
+           && (impl::has_half_line_validator_v<rhs_result_type> || (impl::operand_traits<rhs_result_type>::is_physical && impl::has_trivial_validator_v<rhs_result_type>)))
+    };
+
+    constexpr binary_expression(const LHS& lhs, const RHS& rhs)
+      : m_LHS{lhs}
+      , m_RHS{rhs}
+    {
+      if constexpr(LHS::is_bulk && RHS::is_bulk)
+      {
+        if(m_LHS.size() != m_RHS.size())
+          throw std::logic_error{std::format("binary_expression: size mismatch, {} vs {}", m_LHS.size().value(), m_RHS.size().value())};
+      }
+    }
+
+    [[nodiscard]]
+    constexpr std::optional<std::size_t> size() const noexcept
+    {
+      if constexpr(LHS::is_bulk) return m_LHS.size();
+      else                       return m_RHS.size();
+    }
+
+    [[nodiscard]]
+    constexpr std::array<value_type, dimension> raw_values(std::size_t k) const
+    {
+      const auto lhs{m_LHS.values(k)};
+      const auto rhs{m_RHS.values(k)};
+
+      return [&] <std::size_t... Is>(std::index_sequence<Is...>) {
+        return std::array<value_type, dimension>{
+          static_cast<value_type>(Op{}(lhs[LHS::dimension == 1 ? 0 : Is], rhs[RHS::dimension == 1 ? 0 : Is]))...
+        };
+      }(std::make_index_sequence<dimension>{});
+    }
+
+    [[nodiscard]]
+    constexpr std::array<value_type, dimension> values(std::size_t k) const
+    {
+      if constexpr(preserves_validity)
+        return raw_values(k);
+      else
+        return impl::validate<validator_type>(raw_values(k));
+    }
+  private:
+    LHS m_LHS;
+    RHS m_RHS;
+  };
+
+  template<class T>
+  struct is_physical_expression<value_expression<T>> : std::true_type {};
+
+  template<class PhysicalValue>
+  struct is_physical_expression<array_expression<PhysicalValue>> : std::true_type {};
+
+  template<class Op, class LHS, class RHS>
+  struct is_physical_expression<binary_expression<Op, LHS, RHS>> : std::true_type {};
+
+  template<class T>
+    requires is_physical_value_v<T>
+  [[nodiscard]]
+  constexpr value_expression<T> lazy(const T& t)
+  {
+    return value_expression<T>{t};
+  }
+
+  template<class PhysicalValue>
+  [[nodiscard]]
+  constexpr array_expression<PhysicalValue> lazy(const physical_value_array<PhysicalValue>& a) noexcept
+  {
+    return array_expression<PhysicalValue>{a};
+  }
+
+  template<class PhysicalValue>
+  void lazy(const physical_value_array<PhysicalValue>&&) = delete;
+
+  namespace impl
+  {
+    template<class T>
+    [[nodiscard]]
+    constexpr auto to_expression(const T& t)
+    {
+      if constexpr(physical_expression<T>)
+        return t;
+      else if constexpr(is_physical_value_v<T>)
+        return value_expression<T>{t};
+      else if constexpr(arithmetic<T>)
+        return value_expression<T>{t};
+      else
+        return lazy(t);
+    }
+
+    template<class T>
+    using to_expression_t = decltype(to_expression(std::declval<const T&>()));
+
+    template<class T>
+    inline constexpr bool is_lazy_operand_v{
+      physical_expression<T> || arithmetic<T> || requires (const T& t) { lazy(t); }
+    };
+
+    template<class Op, class L, class R>
+    inline constexpr bool is_lazily_composable_v{
+         (physical_expression<L> || physical_expression<R>)
+      && is_lazy_operand_v<L> && is_lazy_operand_v<R>
+      && requires { typename binary_expression<Op, to_expression_t<L>, to_expression_t<R>>; }
+    };
+
+    template<class Op, class L, class R>
+    [[nodiscard]]
+    constexpr auto make_expression(const L& l, const R& r)
+    {
+      return binary_expression<Op, to_expression_t<L>, to_expression_t<R>>{to_expression(l), to_expression(r)};
+    }
+  }
+
+  template<class L, class R>
+    requires impl::is_lazily_composable_v<std::plus<>, L, R>
+  [[nodiscard]]
+  constexpr auto operator+(const L& l, const R& r)
+  {
+    return impl::make_expression<std::plus<>>(l, r);
+  }
+
+  template<class L, class R>
+    requires impl::is_lazily_composable_v<std::minus<>, L, R>
+  [[nodiscard]]
+  constexpr auto operator-(const L& l, const R& r)
+  {
+    return impl::make_expression<std::minus<>>(l, r);
+  }
+
+  template<class L, class R>
+    requires impl::is_lazily_composable_v<std::multiplies<>, L, R>
+  [[nodiscard]]
+  constexpr auto operator*(const L& l, const R& r)
+  {
+    return impl::make_expression<std::multiplies<>>(l, r);
+  }
+
+  template<class L, class R>
+    requires impl::is_lazily_composable_v<std::divides<>, L, R>
+  [[nodiscard]]
+  constexpr auto operator/(const L& l, const R& r)
+  {
+    return impl::make_expression<std::divides<>>(l, r);
+  }
+
+  /** @brief Since arrays are held by reference, composing a temporary array would leave the expression dangling */
+  template<class L, class PhysicalValue>
+    requires impl::is_lazily_composable_v<std::plus<>, L, physical_value_array<PhysicalValue>>
+  void operator+(const L&, const physical_value_array<PhysicalValue>&&) = delete;
+
+  template<class PhysicalValue, class R>
+    requires impl::is_lazily_composable_v<std::plus<>, physical_value_array<PhysicalValue>, R>
+  void operator+(const physical_value_array<PhysicalValue>&&, const R&) = delete;
+
+  template<class L, class PhysicalValue>
+    requires impl::is_lazily_composable_v<std::minus<>, L, physical_value_array<PhysicalValue>>
+  void operator-(const L&, const physical_value_array<PhysicalValue>&&) = delete;
+
+  template<class PhysicalValue, class R>
+    requires impl::is_lazily_composable_v<std::minus<>, physical_value_array<PhysicalValue>, R>
+  void operator-(const physical_value_array<PhysicalValue>&&, const R&) = delete;
+
+  template<class L, class PhysicalValue>
+    requires impl::is_lazily_composable_v<std::multiplies<>, L, physical_value_array<PhysicalValue>>
+  void operator*(const L&, const physical_value_array<PhysicalValue>&&) = delete;
+
+  template<class PhysicalValue, class R>
+    requires impl::is_lazily_composable_v<std::multiplies<>, physical_value_array<PhysicalValue>, R>
+  void operator*(const physical_value_array<PhysicalValue>&&, const R&) = delete;
+
+  template<class L, class PhysicalValue>
+    requires impl::is_lazily_composable_v<std::divides<>, L, physical_value_array<PhysicalValue>>
+  void operator/(const L&, const physical_value_array<PhysicalValue>&&) = delete;
+
+  template<class PhysicalValue, class R>
+    requires impl::is_lazily_composable_v<std::divides<>, physical_value_array<PhysicalValue>, R>
+  void operator/(const physical_value_array<PhysicalValue>&&, const R&) = delete;
+
+  /** @brief Evaluates an expression in a single pass, validating the final result.
+
+      For bulk expressions, the result is a physical_value_array (or a std::vector, if the
+      result is a bare number), validated as a single batch.
+   */
+  template<physical_expression Expr>
+  [[nodiscard]]
+  constexpr auto evaluate(const Expr& expr)
+  {
+    using result_type = Expr::result_type;
+    using value_type  = Expr::value_type;
+    constexpr auto D{Expr::dimension};
+
+    if constexpr(Expr::is_bulk)
+    {
+      const auto n{expr.size().value()};
+      std::array<std::vector<value_type>, D> components{};
+      for(auto& c : components) c.resize(n);
+
+      for(std::size_t k{}; k < n; ++k)
+      {
+        const auto vals{expr.raw_values(k)};
+        for(std::size_t i{}; i < D; ++i)
+          components[i][k] = vals[i];
+      }
+
+      if constexpr(is_physical_value_v<result_type>)
+        return physical_value_array<result_type>{std::move(components), typename result_type::units_type{}};
+      else
+        return std::move(components.front());
+    }
+    else
+    {
+      const auto vals{expr.raw_values(0)};
+      if constexpr(!is_physical_value_v<result_type>)
+        return vals.front();
+      else if constexpr(D == 1)
+        return result_type{vals.front(), typename result_type::units_type{}};
+      else
+        return result_type{vals, typename result_type::units_type{}};
+    }
+  }
+}
@@ -11,7 +11,7 @@
 
 #include "PlatformDiscriminators.hpp"
 
-#include <execution>
+#include <type_traits>
 #include <vector>
 
 namespace sequoia
@@ -45,18 +45,6 @@ namespace sequoia
     #define SEQUOIA_NO_UNIQUE_ADDRESS [[no_unique_address]]
   #endif
 
-  #if defined(__clang__)
-    namespace execution
-    {
-      inline constexpr int par{0};
-    }
-  #else
-    namespace execution
-    {
-      inline constexpr auto par{std::execution::par};
-    }
-  #endif
-
   inline constexpr bool with_msvc_v{std::is_same_v<compiler_constant, msvc_type>};
   inline constexpr bool with_clang_v{std::is_same_v<compiler_constant, clang_type>};
   inline constexpr bool with_gcc_v{std::is_same_v<compiler_constant, gcc_type>};
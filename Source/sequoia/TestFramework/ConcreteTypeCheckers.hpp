@@ -462,30 +462,33 @@ namespace sequoia::testing
     template<test_mode Mode, class Customization, invocable_r<bool, std::filesystem::path, std::filesystem::path> FinalTokenComparison>
     static void check_path(test_logger<Mode>& logger, const Customization& custom, const std::filesystem::path& path, const std::filesystem::path& prediction, FinalTokenComparison compare)
     {
-      namespace fs = std::filesystem;
+      check_path(logger, custom, take_snapshot(path), take_snapshot(prediction), compare);
+    }
 
-      const auto pathType{fs::status(path).type()};
-      const auto predictionType{fs::status(prediction).type()};
+    template<test_mode Mode, class Customization, invocable_r<bool, std::filesystem::path, std::filesystem::path> FinalTokenComparison>
+    static void check_path(test_logger<Mode>& logger, const Customization& custom, const path_snapshot& path, const path_snapshot& prediction, FinalTokenComparison compare)
+    {
+      namespace fs = std::filesystem;
 
-      if(check(equality, path_check_preamble("Path type", path, prediction), logger, pathType, predictionType))
+      if(check(equality, path_check_preamble("Path type", path.path, prediction.path), logger, path.type, prediction.type))
       {
-        if(!path.empty())
+        if(!path.path.empty())
         {
-          const auto pathFinalToken{back(path)};
-          const auto predictionFinalToken{back(prediction)};
+          const auto pathFinalToken{back(path.path)};
+          const auto predictionFinalToken{back(prediction.path)};
           if(compare(pathFinalToken, predictionFinalToken))
           {
-            switch(pathType)
+            switch(path.type)
             {
             case fs::file_type::regular:
-              check_file(logger, custom, path, prediction);
+              check_file(logger, custom, path.path, prediction.path);
               break;
             case fs::file_type::directory:
               check_directory(logger, custom, path, prediction, compare);
               break;
             default:
               throw std::logic_error{std::string{"Detailed equivalance check for paths of type '"}
-                .append(serializer<fs::file_type>::make(pathType)).append("' not currently implemented")};
+                .append(serializer<fs::file_type>::make(path.type)).append("' not currently implemented")};
             }
           }
         }
@@ -493,59 +496,57 @@ namespace sequoia::testing
     }
 
     template<test_mode Mode, class Customization, invocable_r<bool, std::filesystem::path, std::filesystem::path> FinalTokenComparison>
-    static void check_directory(test_logger<Mode>& logger, const Customization& custom, const std::filesystem::path& dir, const std::filesystem::path& prediction, FinalTokenComparison compare)
+    static void check_directory(test_logger<Mode>& logger, const Customization& custom, const path_snapshot& dir, const path_snapshot& prediction, FinalTokenComparison compare)
     {
       namespace fs = std::filesystem;
 
       auto generator{
-        [](const fs::path& dirPath) {
-          std::vector<fs::path> paths{};
-          for(const auto& p : fs::directory_iterator(dirPath))
+        [](const path_snapshot& snapshot) {
+          std::vector<const path_snapshot*> entries{};
+          for(const auto& e : snapshot.entries)
           {
-            if(    std::ranges::find(excluded_files,      p.path().filename())  == excluded_files.end()
-                && std::ranges::find(excluded_extensions, p.path().extension()) == excluded_extensions.end())
+            if(    std::ranges::find(excluded_files,      e.path.filename())  == excluded_files.end()
+                && std::ranges::find(excluded_extensions, e.path.extension()) == excluded_extensions.end())
             {
-               paths.push_back(p);
+               entries.push_back(&e);
             }
           }
 
-          std::ranges::sort(paths);
-
-          return paths;
+          return entries;
         }
       };
 
-      const std::vector<fs::path> paths{generator(dir)}, predictedPaths{generator(prediction)};
+      const std::vector<const path_snapshot*> paths{generator(dir)}, predictedPaths{generator(prediction)};
 
       check(
 	equality,
-	std::string{"Number of directory entries for "}.append(dir.generic_string()),
+	std::string{"Number of directory entries for "}.append(dir.path.generic_string()),
         logger,
         paths.size(),
         predictedPaths.size()
       );
 
       const auto iters{std::ranges::mismatch(paths, predictedPaths,
-          [&dir,&prediction](const fs::path& lhs, const fs::path& rhs) {
-            return fs::relative(lhs, dir) == fs::relative(rhs, prediction);
+          [](const path_snapshot* lhs, const path_snapshot* rhs) {
+            return lhs->filename() == rhs->filename();
           })};
       if((iters.in1 != paths.end()) && (iters.in2 != predictedPaths.end()))
       {
-        check(equality, "First directory entry mismatch", logger, *iters.in1, *iters.in2);
+        check(equality, "First directory entry mismatch", logger, (*iters.in1)->path, (*iters.in2)->path);
       }
       else if(iters.in1 != paths.end())
       {
-        check(equality, "First directory entry mismatch", logger, *iters.in1, fs::path{});
+        check(equality, "First directory entry mismatch", logger, (*iters.in1)->path, fs::path{});
       }
       else if(iters.in2 != predictedPaths.end())
       {
-        check(equality, "First directory entry mismatch", logger, fs::path{}, *iters.in2);
+        check(equality, "First directory entry mismatch", logger, fs::path{}, (*iters.in2)->path);
       }
       else
       {
         for(std::size_t i{}; i < paths.size(); ++i)
         {
-          check_path(logger, custom, paths[i], predictedPaths[i], compare);
+          check_path(logger, custom, *paths[i], *predictedPaths[i], compare);
         }
       }
     }
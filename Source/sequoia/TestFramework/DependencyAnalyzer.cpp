@@ -13,11 +13,12 @@
 #include "sequoia/TestFramework/FileSystemUtilities.hpp"
 
 #include "sequoia/Maths/Graph/DynamicGraph.hpp"
-#include "sequoia/Maths/Graph/GraphTraversalFunctions.hpp"
+#include "sequoia/Maths/Graph/GraphAlgorithms.hpp"
 #include "sequoia/Streaming/Streaming.hpp"
 
 #include <chrono>
 #include <fstream>
+#include <numeric>
 
 namespace sequoia::testing
 {
@@ -219,17 +220,23 @@ namespace sequoia::testing
     }
 
     /// pre-condition: the nodes of g have been sorted by file path
-    void build_dependencies(tests_dependency_graph& g, const project_paths& projPaths, std::string_view cutoff)
+    void build_dependencies(tests_dependency_graph& g, const project_paths& projPaths, std::string_view cutoff, const task_executor& executor)
     {
       using size_type = tests_dependency_graph::size_type;
       std::vector<fs::path> externalDependencies{};
 
+      // Reading the files dominates; the graph itself is subsequently built serially
+      std::vector<std::vector<fs::path>> includes(g.order());
+      executor.for_each(std::views::iota(size_type{}, g.order()), [&g, &includes, cutoff](size_type n) {
+        includes[n] = get_includes(g.cbegin_node_weights()[n].file, cutoff);
+      });
+
       for(auto i{g.begin_node_weights()}; i != g.end_node_weights(); ++i)
       {
         const auto nodePos{static_cast<size_type>(std::ranges::distance(g.begin_node_weights(), i))};
         const auto& file{i->file};
 
-        for(const auto& includedFile : get_includes(file, cutoff))
+        for(const auto& includedFile : includes[nodePos])
         {
           if(auto eqrange{std::ranges::equal_range(g.node_weights(), includedFile.filename(), std::ranges::less{}, [](const file_info& weight){ return weight.file.filename(); })}; !eqrange.empty())
           {
@@ -306,6 +313,63 @@ namespace sequoia::testing
       write_tests(projPaths.prune().external_dependencies(), externalDependencies);
     }
 
+    /*! \brief Renders a file stale, and its implicit modification time the latest, if this is true of
+        any file on which it depends, directly or indirectly.
+
+        Files which include one another, directly or indirectly, form a strongly connected component
+        and so share the same status. Since edges lead from components to those with lower numbers,
+        a single sweep in increasing order visits every dependency before its dependents.
+     */
+    void propagate_staleness(tests_dependency_graph& g)
+    {
+      using size_type = tests_dependency_graph::size_type;
+
+      const auto [componentOf, componentSizes]{maths::strongly_connected_components(g)};
+      const auto numComponents{componentSizes.size()};
+
+      // Bucket the nodes by component
+      std::vector<size_type> offsets(numComponents + 1), members(g.order());
+      std::partial_sum(componentSizes.begin(), componentSizes.end(), std::next(offsets.begin()));
+
+      auto next{offsets};
+      for(size_type n{}; n < g.order(); ++n) members[next[componentOf[n]]++] = n;
+
+      struct status
+      {
+        fs::file_time_type implicit_modification_time{fs::file_time_type::min()};
+        bool stale{};
+      };
+
+      std::vector<status> statuses(numComponents);
+      for(size_type c{}; c < numComponents; ++c)
+      {
+        auto& st{statuses[c]};
+        for(auto m{offsets[c]}; m < offsets[c + 1]; ++m)
+        {
+          const auto node{members[m]};
+          const auto& wt{g.cbegin_node_weights()[node]};
+          st.implicit_modification_time = std::ranges::max(st.implicit_modification_time, wt.implicit_modification_time);
+          st.stale = st.stale || wt.stale;
+
+          for(const auto& edge : g.cedges(node))
+          {
+            if(const auto target{componentOf[edge.target_node()]}; target != c)
+            {
+              st.implicit_modification_time = std::ranges::max(st.implicit_modification_time, statuses[target].implicit_modification_time);
+              st.stale = st.stale || statuses[target].stale;
+            }
+          }
+        }
+
+        for(auto m{offsets[c]}; m < offsets[c + 1]; ++m)
+        {
+          auto& wt{g.begin_node_weights()[members[m]]};
+          wt.implicit_modification_time = st.implicit_modification_time;
+          wt.stale = st.stale;
+        }
+      }
+    }
+
     [[nodiscard]]
     bool materials_modified(const fs::path& relFilePath,
                             const fs::path& materialsRepo,
@@ -361,10 +425,8 @@ namespace sequoia::testing
     }
 
     [[nodiscard]]
-    std::vector<fs::path> find_stale_tests(fs::file_time_type pruneTimeStamp, const project_paths& projPaths, std::string_view cutoff)
+    std::vector<fs::path> find_stale_tests(fs::file_time_type pruneTimeStamp, const project_paths& projPaths, std::string_view cutoff, const task_executor& executor)
     {
-      using namespace maths;
-
       tests_dependency_graph g{};
 
       const auto exeTimeStamp{get_stamp(projPaths.executable())};
@@ -395,23 +457,9 @@ namespace sequoia::testing
         g.add_node(info);
       }
 
-      build_dependencies(g, projPaths, cutoff);
-
-      auto nodesLate{
-        [&g](const std::size_t node) {
-          for(const auto& edge : g.cedges(node))
-          {
-            auto& wt{g.begin_node_weights()[node]};
-            auto& targetWt{g.cbegin_node_weights()[edge.target_node()]};
-
-            wt.implicit_modification_time = std::ranges::max(wt.implicit_modification_time, targetWt.implicit_modification_time);
-
-            if(targetWt.stale) wt.stale = true;
-          }
-        }
-      };
+      build_dependencies(g, projPaths, cutoff, executor);
 
-      traverse(depth_first, g, find_disconnected_t{0}, null_func_obj{}, nodesLate);
+      propagate_staleness(g);
 
       const auto passesFile{projPaths.prune().selected_passes(std::nullopt)};
       const auto passingTestsFromFile{read_tests(passesFile)};
@@ -553,14 +601,14 @@ namespace sequoia::testing
 
   [[nodiscard]]
   std::optional<std::vector<fs::path>>
-  tests_to_run(const project_paths& projPaths, std::string_view cutoff)
+  tests_to_run(const project_paths& projPaths, std::string_view cutoff, const task_executor& executor)
   {
     const auto prunePaths{projPaths.prune()};
     const auto pruneTimeStamp{get_stamp(prunePaths.stamp())};
 
     if(!pruneTimeStamp) return std::nullopt;
 
-    const auto staleTests{find_stale_tests(pruneTimeStamp.value(), projPaths, cutoff)};
+    const auto staleTests{find_stale_tests(pruneTimeStamp.value(), projPaths, cutoff, executor)};
 
     const std::vector<fs::path> failingTests{read_tests(prunePaths.failures(std::nullopt))};
 
@@ -13,6 +13,7 @@
  */
 
 #include "sequoia/TestFramework/ProjectPaths.hpp"
+#include "sequoia/TestFramework/TaskExecutor.hpp"
 
 namespace sequoia::testing
 {
@@ -26,7 +27,7 @@ namespace sequoia::testing
   void write_tests(const project_paths& projPaths, const std::filesystem::path& file, const std::vector<std::filesystem::path>& tests);
 
   [[nodiscard]]
-  std::optional<std::vector<std::filesystem::path>> tests_to_run(const project_paths& projPaths, std::string_view cutoff);
+  std::optional<std::vector<std::filesystem::path>> tests_to_run(const project_paths& projPaths, std::string_view cutoff, const task_executor& executor = {});
 
   void update_prune_files(const project_paths& projPaths,
                           std::vector<std::filesystem::path> failedTests,
@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <regex>
 
 namespace sequoia::testing
@@ -213,6 +215,82 @@ namespace sequoia::testing
     read_modify_write(cmakeLists, addEntry);
   }
 
+  struct masking_patterns::compiled_expressions
+  {
+    std::vector<std::regex> expressions{};
+  };
+
+  masking_patterns::masking_patterns(std::string_view expressions)
+  {
+    constexpr auto flags{std::regex::ECMAScript | std::regex::optimize};
+    auto compiled{std::make_shared<compiled_expressions>()};
+
+    std::string_view::size_type pos{};
+    while(pos < expressions.size())
+    {
+      const auto next{std::min(expressions.find('\n', pos), expressions.size())};
+      const auto pattern{expressions.substr(pos, next - pos)};
+      if(pattern.empty()) break;
+
+      compiled->expressions.emplace_back(pattern.begin(), pattern.end(), flags);
+      pos = next + 1;
+    }
+
+    m_NumPatterns = compiled->expressions.size();
+    m_Compiled    = std::move(compiled);
+  }
+
+  [[nodiscard]]
+  std::string masking_patterns::apply(std::string_view text) const
+  {
+    if(empty()) return std::string{text};
+
+    std::string masked{}, buffer{};
+    masked.reserve(text.size());
+
+    for(const auto& rgx : m_Compiled->expressions)
+    {
+      buffer.clear();
+      std::regex_replace(std::back_inserter(buffer), text.begin(), text.end(), rgx, "");
+      std::swap(masked, buffer);
+      text = masked;
+    }
+
+    return masked;
+  }
+
+  [[nodiscard]]
+  std::shared_ptr<const masking_patterns> get_masking_patterns(const std::filesystem::path& seqpatFile)
+  {
+    namespace fs = std::filesystem;
+
+    struct cache_entry
+    {
+      fs::file_time_type last_write{};
+      std::shared_ptr<const masking_patterns> patterns{};
+    };
+
+    static std::mutex cacheMutex{};
+    static std::map<fs::path, cache_entry> cache{};
+
+    const auto lastWrite{fs::last_write_time(seqpatFile)};
+    {
+      std::scoped_lock lock{cacheMutex};
+      if(auto found{cache.find(seqpatFile)}; (found != cache.end()) && (found->second.last_write == lastWrite))
+        return found->second.patterns;
+    }
+
+    const auto expressions{read_to_string(seqpatFile)};
+    if(!expressions)
+      throw std::runtime_error{report_failed_read(seqpatFile)};
+
+    auto patterns{std::make_shared<const masking_patterns>(expressions.value())};
+
+    std::scoped_lock lock{cacheMutex};
+    cache.insert_or_assign(seqpatFile, cache_entry{lastWrite, patterns});
+    return patterns;
+  }
+
   [[nodiscard]]
   reduced_file_contents get_reduced_file_content(const std::filesystem::path& file, const std::filesystem::path& prediction)
   {
@@ -226,30 +304,10 @@ namespace sequoia::testing
         auto supplPath{[](fs::path f) { return f.replace_extension(seqpat); }(prediction)};
         if(fs::exists(supplPath))
         {
-          if(auto exprContents{read_to_string(supplPath)})
-          {
-            const auto& expressions{exprContents.value()};
-
-            std::string::size_type pos{};
-            while(pos < expressions.size())
-            {
-              const auto next{std::min(expressions.find("\n", pos), expressions.size())};
-              if(const auto count{next - pos})
-              {
-                std::basic_regex rgx{expressions.data() + pos, count};
-                contents.working = std::regex_replace(contents.working.value(), rgx, std::string{});
-                contents.prediction = std::regex_replace(contents.prediction.value(), rgx, std::string{});
-                pos = next + 1;
-              }
-              else
-              {
-                break;
-              }
-            }
-          }
-          else
+          if(const auto patterns{get_masking_patterns(supplPath)}; !patterns->empty())
           {
-            throw std::runtime_error{report_failed_read(supplPath)};
+            contents.working    = patterns->apply(contents.working.value());
+            contents.prediction = patterns->apply(contents.prediction.value());
           }
         }
       }
@@ -15,7 +15,10 @@
 #include "sequoia/TextProcessing/Indent.hpp"
 
 #include <filesystem>
+#include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace sequoia::testing
@@ -32,6 +35,44 @@ namespace sequoia::testing
   void add_to_suite(const std::filesystem::path& file, std::string_view suiteName, indentation indent, const std::vector<std::string>& tests);
 
 
+  /*! \brief The patterns of a .seqpat file, compiled once and then reused.
+
+      Each line, up to the first empty line, is an ECMAScript regular expression. The patterns
+      are applied in turn, each to the result of its predecessor, and their matches removed.
+      Since the removal of one match may create or destroy a match of a later pattern, the
+      patterns are not combined into a single expression, which would mask different text.
+   */
+  class masking_patterns
+  {
+  public:
+    masking_patterns() = default;
+
+    explicit masking_patterns(std::string_view expressions);
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return m_NumPatterns; }
+
+    [[nodiscard]]
+    bool empty() const noexcept { return !m_NumPatterns; }
+
+    [[nodiscard]]
+    std::string apply(std::string_view text) const;
+  private:
+    /// Defined in the source file, keeping <regex> out of this header
+    struct compiled_expressions;
+
+    std::shared_ptr<const compiled_expressions> m_Compiled{};
+    std::size_t m_NumPatterns{};
+  };
+
+  /*! \brief Returns the compiled patterns for a .seqpat file.
+
+      Compilation happens at most once per run for each file, unless the file is modified in
+      the interim. The cache is thread-safe and the patterns may be shared across threads.
+   */
+  [[nodiscard]]
+  std::shared_ptr<const masking_patterns> get_masking_patterns(const std::filesystem::path& seqpatFile);
+
   struct reduced_file_contents
   {
     std::optional<std::string> working, prediction;
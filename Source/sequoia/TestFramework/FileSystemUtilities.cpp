@@ -15,6 +15,7 @@
 #include "sequoia/TestFramework/Output.hpp"
 #include "sequoia/TextProcessing/Substitutions.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace sequoia::testing
@@ -31,6 +32,40 @@ namespace sequoia::testing
         throw std::runtime_error{p.empty() ? std::string{message} : p.generic_string().append(" ").append(message)};
       }
     }
+
+    /// Avoids calls to stat if the type of the entry was reported by the directory iteration
+    [[nodiscard]]
+    fs::file_type entry_type(const fs::directory_entry& entry)
+    {
+      if(entry.is_directory())    return fs::file_type::directory;
+      if(entry.is_regular_file()) return fs::file_type::regular;
+
+      return entry.status().type();
+    }
+
+    void record_metadata(path_snapshot& snapshot, snapshot_detail detail)
+    {
+      if((detail == snapshot_detail::metadata) && snapshot.is_regular_file())
+      {
+        snapshot.size       = fs::file_size(snapshot.path);
+        snapshot.last_write = fs::last_write_time(snapshot.path);
+      }
+    }
+
+    void populate_entries(path_snapshot& snapshot, snapshot_detail detail, const task_executor& executor)
+    {
+      for(const auto& entry : fs::directory_iterator(snapshot.path))
+      {
+        path_snapshot& e{snapshot.entries.emplace_back(entry.path(), entry_type(entry))};
+        record_metadata(e, detail);
+      }
+
+      std::ranges::sort(snapshot.entries, snapshot_order{});
+
+      executor.for_each(snapshot.entries, [detail, &executor](path_snapshot& e) {
+        if(e.is_directory()) populate_entries(e, detail, executor);
+      });
+    }
   }
 
   [[nodiscard]]
@@ -148,4 +183,24 @@ namespace sequoia::testing
 
     return std::accumulate(rebasedPathIter, p.end(), fs::path{}, [](fs::path lhs, const fs::path& rhs){ return lhs /= rhs; });
   }
+
+  [[nodiscard]]
+  bool snapshot_order::operator()(const path_snapshot& lhs, const path_snapshot& rhs) const
+  {
+    using type = std::underlying_type_t<fs::file_type>;
+
+    const auto lhsName{lhs.filename()}, rhsName{rhs.filename()};
+    return (lhsName == rhsName) ? static_cast<type>(lhs.type) < static_cast<type>(rhs.type) : lhsName < rhsName;
+  }
+
+  [[nodiscard]]
+  path_snapshot take_snapshot(const fs::path& p, snapshot_detail detail, const task_executor& executor)
+  {
+    path_snapshot snapshot{p, fs::status(p).type()};
+    record_metadata(snapshot, detail);
+    if(snapshot.is_directory())
+      populate_entries(snapshot, detail, executor);
+
+    return snapshot;
+  }
 }
@@ -12,8 +12,10 @@
  */
 
 #include "sequoia/TestFramework/CoreInfrastructure.hpp"
+#include "sequoia/TestFramework/TaskExecutor.hpp"
 
 #include <filesystem>
+#include <vector>
 
 namespace sequoia::testing
 {
@@ -42,4 +44,46 @@ namespace sequoia::testing
 
   [[nodiscard]]
   std::filesystem::path rebase_from(const std::filesystem::path& filename, const std::filesystem::path& dir);
+
+  enum class snapshot_detail { types = 0, metadata };
+
+  /*! \brief The state of a path, and recursively of any directory entries, captured in a single pass.
+
+      The entries of a directory are read with a single `directory_iterator` pass and sorted
+      first by filename and then by type, so that subsequent comparisons require no further
+      calls to the file system. Where the platform reports the type of an entry as part of
+      the directory listing, taking a snapshot of type information only requires no calls
+      to `stat`. The size and last write time of regular files are captured only if
+      `snapshot_detail::metadata` is requested.
+   */
+  struct path_snapshot
+  {
+    std::filesystem::path path{};
+    std::filesystem::file_type type{std::filesystem::file_type::none};
+    std::uintmax_t size{};
+    std::filesystem::file_time_type last_write{};
+    std::vector<path_snapshot> entries{};
+
+    [[nodiscard]]
+    std::filesystem::path filename() const { return path.filename(); }
+
+    [[nodiscard]]
+    bool is_directory() const noexcept { return type == std::filesystem::file_type::directory; }
+
+    [[nodiscard]]
+    bool is_regular_file() const noexcept { return type == std::filesystem::file_type::regular; }
+  };
+
+  /*! \brief Orders snapshots of entries of the same directory by filename and then type */
+  struct snapshot_order
+  {
+    [[nodiscard]]
+    bool operator()(const path_snapshot& lhs, const path_snapshot& rhs) const;
+  };
+
+  /*! \brief Snapshots `p` and, if it is a directory, its entire tree; distinct subtrees are processed in parallel by `executor`. */
+  [[nodiscard]]
+  path_snapshot take_snapshot(const std::filesystem::path& p,
+                              snapshot_detail detail = snapshot_detail::types,
+                              const task_executor& executor = {});
 }
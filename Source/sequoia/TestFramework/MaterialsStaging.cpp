@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Definitions for MaterialsStaging.hpp
+*/
+
+#include "sequoia/TestFramework/MaterialsStaging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <linux/fs.h>
+  #include <sys/ioctl.h>
+  #include <unistd.h>
+#elif defined(__APPLE__)
+  #include <sys/clonefile.h>
+#endif
+
+namespace sequoia::testing
+{
+  namespace fs = std::filesystem;
+
+  namespace
+  {
+    enum class staged_by { copy, clone, link };
+
+    struct staging_task
+    {
+      fs::path from, to;
+      std::uintmax_t bytes{};
+      staged_by method{staged_by::copy};
+    };
+
+    [[nodiscard]]
+    bool clone_file([[maybe_unused]] const fs::path& from, [[maybe_unused]] const fs::path& to)
+    {
+    #if defined(__linux__) && defined(FICLONE)
+      const int src{::open(from.c_str(), O_RDONLY | O_CLOEXEC)};
+      if(src < 0) return false;
+
+      bool cloned{};
+      if(const int dst{::open(to.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)}; dst >= 0)
+      {
+        cloned = (::ioctl(dst, FICLONE, src) == 0);
+        ::close(dst);
+      }
+
+      ::close(src);
+
+      std::error_code ec{};
+      if(cloned)
+        fs::permissions(to, fs::status(from).permissions(), ec);
+      else
+        fs::remove(to, ec);
+
+      return cloned;
+    #elif defined(__APPLE__)
+      return ::clonefile(from.c_str(), to.c_str(), 0) == 0;
+    #else
+      return false;
+    #endif
+    }
+
+    /// Once a technique fails for one file in a tree, it is not attempted for the remainder
+    class file_stager
+    {
+    public:
+      explicit file_stager(file_staging staging)
+        : m_TryLink{staging == file_staging::link}
+        , m_TryClone{staging != file_staging::copy}
+      {}
+
+      void operator()(staging_task& task)
+      {
+        std::error_code ec{};
+        if(m_TryLink.load(std::memory_order_relaxed))
+        {
+          fs::create_hard_link(task.from, task.to, ec);
+          if(!ec)
+          {
+            task.method = staged_by::link;
+            return;
+          }
+
+          m_TryLink.store(false, std::memory_order_relaxed);
+        }
+
+        if(m_TryClone.load(std::memory_order_relaxed))
+        {
+          if(clone_file(task.from, task.to))
+          {
+            task.method = staged_by::clone;
+            return;
+          }
+
+          m_TryClone.store(false, std::memory_order_relaxed);
+        }
+
+        fs::copy_file(task.from, task.to, fs::copy_options::overwrite_existing);
+        task.method = staged_by::copy;
+      }
+    private:
+      std::atomic<bool> m_TryLink, m_TryClone;
+    };
+  }
+
+  staging_statistics& staging_statistics::operator+=(const staging_statistics& rhs) noexcept
+  {
+    bytes_copied += rhs.bytes_copied;
+    bytes_cloned += rhs.bytes_cloned;
+    bytes_linked += rhs.bytes_linked;
+    files        += rhs.files;
+    time         += rhs.time;
+
+    return *this;
+  }
+
+  staging_statistics stage_directory(const fs::path& from, const fs::path& to, file_staging staging, const task_executor& executor)
+  {
+    const auto start{std::chrono::steady_clock::now()};
+
+    fs::create_directories(to);
+
+    // Symlinks are staged as their targets; the relative path is computed lexically, since fs::relative would resolve them
+    std::vector<staging_task> tasks{};
+    for(const auto& entry : fs::recursive_directory_iterator(from, fs::directory_options::follow_directory_symlink))
+    {
+      const auto target{to / entry.path().lexically_relative(from)};
+      if(entry.is_directory())
+      {
+        fs::create_directories(target);
+      }
+      else if(entry.is_regular_file())
+      {
+        tasks.push_back({entry.path(), target, entry.file_size()});
+      }
+      else
+      {
+        throw std::runtime_error{"stage_directory: unable to stage " + entry.path().generic_string() + ", which is neither a directory nor a regular file"};
+      }
+    }
+
+    file_stager stager{staging};
+    executor.for_each(tasks, [&stager](staging_task& task) { stager(task); });
+
+    staging_statistics stats{.files{tasks.size()}};
+    for(const auto& task : tasks)
+    {
+      switch(task.method)
+      {
+      case staged_by::copy:
+        stats.bytes_copied += task.bytes;
+        break;
+      case staged_by::clone:
+        stats.bytes_cloned += task.bytes;
+        break;
+      case staged_by::link:
+        stats.bytes_linked += task.bytes;
+        break;
+      }
+    }
+
+    stats.time = std::chrono::steady_clock::now() - start;
+
+    return stats;
+  }
+
+  [[nodiscard]]
+  file_staging working_staging(staging_mode mode) noexcept
+  {
+    return mode == staging_mode::copy ? file_staging::copy : file_staging::clone;
+  }
+
+  [[nodiscard]]
+  file_staging auxiliary_staging(staging_mode mode) noexcept
+  {
+    switch(mode)
+    {
+    case staging_mode::copy:
+      return file_staging::copy;
+    case staging_mode::clone:
+      return file_staging::clone;
+    case staging_mode::link:
+      return file_staging::link;
+    }
+
+    return file_staging::copy;
+  }
+}
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Utilities for staging test materials into the temporary directory in which tests run.
+
+    Rather than copying every byte of every file, files may be cloned (reflinked) on file
+    systems which support copy-on-write, or hard linked where the staged files are
+    guaranteed not to be modified. Whenever the requested technique is unavailable,
+    staging falls back to a conventional copy. Files are staged in parallel by the
+    supplied executor.
+ */
+
+#include "sequoia/TestFramework/StagingStatistics.hpp"
+#include "sequoia/TestFramework/TaskExecutor.hpp"
+
+#include <filesystem>
+
+namespace sequoia::testing
+{
+  /*! \brief How a single tree of files is staged */
+  enum class file_staging {
+    copy,  /// byte-for-byte copy
+    clone, /// copy-on-write clone, falling back to copy
+    link   /// hard link, falling back to clone
+  };
+
+  /*! \brief Runner-wide choice of staging for the working and auxiliary materials.
+
+      Working materials may be modified by tests and so are never hard linked. Auxiliary
+      materials are hard linked only in `link` mode, in which case tests must treat them
+      as read-only.
+   */
+  enum class staging_mode { copy, clone, link };
+
+  /*! \brief Recreates the directory tree rooted at `from` at `to`, which is created if necessary */
+  staging_statistics stage_directory(const std::filesystem::path& from,
+                                     const std::filesystem::path& to,
+                                     file_staging staging,
+                                     const task_executor& executor = {});
+
+  [[nodiscard]]
+  file_staging working_staging(staging_mode mode) noexcept;
+
+  [[nodiscard]]
+  file_staging auxiliary_staging(staging_mode mode) noexcept;
+}
@@ -53,127 +53,106 @@ namespace sequoia::testing
       }
     }
 
-    struct path_info
+    /// Special files are copied back level by level, descending only into directories present in both trees
+    void copy_special_files_back_recursive(const fs::path& from, const fs::path& to)
     {
-      fs::path full, relative;
-    };
+      copy_special_files_back(from, to);
 
-    struct compare
-    {
-      [[nodiscard]]
-      bool operator()(const path_info& lhs, const path_info& rhs) const
-      {
-        using type = std::underlying_type_t<fs::file_type>;
-
-        return (lhs.relative == rhs.relative)
-          ? static_cast<type>(fs::status(lhs.full).type()) < static_cast<type>(fs::status(rhs.full).type())
-          : lhs.relative < rhs.relative;
-      };
-    };
-
-    [[nodiscard]]
-    std::vector<path_info> sort_dir_entries(const fs::path& dir)
-    {
-      std::vector<path_info> paths{};
-      for(auto& entry : fs::directory_iterator(dir))
+      for(auto& p : fs::directory_iterator(to))
       {
-        paths.push_back({entry.path(), fs::relative(entry.path(), dir)});
+        if(p.is_directory())
+        {
+          if(const auto workingSubdir{from / p.path().filename()}; fs::is_directory(workingSubdir))
+            copy_special_files_back_recursive(workingSubdir, p.path());
+        }
       }
-
-      std::ranges::sort(paths, compare{});
-      return paths;
     }
 
-    using paths_iter = std::vector<path_info>::const_iterator;
+    using snapshot_iter = std::vector<path_snapshot>::const_iterator;
 
-    void soft_update(const fs::path& from, const fs::path& to, paths_iter fromBegin, paths_iter fromEnd, paths_iter toBegin, paths_iter toEnd)
+    void soft_update(const fs::path& to, snapshot_iter fromBegin, snapshot_iter fromEnd, snapshot_iter toBegin, snapshot_iter toEnd)
     {
       auto equiv{
-        [](const path_info& lhs, const path_info& rhs) {
-          using type = std::underlying_type_t<fs::file_type>;
-
-          return (lhs.relative == rhs.relative) && (static_cast<type>(fs::status(lhs.full).type()) == static_cast<type>(fs::status(rhs.full).type()));
+        [](const path_snapshot& lhs, const path_snapshot& rhs) {
+          return (lhs.filename() == rhs.filename()) && (lhs.type == rhs.type);
         }
       };
 
       auto iters{std::ranges::mismatch(fromBegin, fromEnd, toBegin, toEnd, equiv)};
       for(auto fi{fromBegin}, ti{toBegin}; fi != iters.in1; ++fi, ++ti)
       {
-        const auto pathType{fs::status(fi->full).type()};
-
-        switch(pathType)
+        switch(fi->type)
         {
         case fs::file_type::regular:
         {
-          const auto [rFrom, rTo] {get_reduced_file_content(fi->full, ti->full)};
+          const auto [rFrom, rTo] {get_reduced_file_content(fi->path, ti->path)};
           if(rFrom && rTo)
           {
             if(rFrom.value() != rTo.value())
             {
-              fs::copy_file(fi->full, ti->full, fs::copy_options::overwrite_existing);
+              fs::copy_file(fi->path, ti->path, fs::copy_options::overwrite_existing);
             }
           }
           break;
         }
         case fs::file_type::directory:
         {
-          testing::soft_update(fi->full, ti->full);
+          soft_update(ti->path, fi->entries.begin(), fi->entries.end(), ti->entries.begin(), ti->entries.end());
           break;
         }
         default:
-          throw std::logic_error{std::format("Detailed equivalance check for paths of type '{}' not currently implemented", serializer<fs::file_type>::make(pathType))};
+          throw std::logic_error{std::format("Detailed equivalance check for paths of type '{}' not currently implemented", serializer<fs::file_type>::make(fi->type))};
         }
       }
 
       if(iters.in1 != fromEnd)
       {
-        for(; (iters.in1 != fromEnd) && ((iters.in2 == toEnd) || (compare{}(*iters.in1, *iters.in2))); ++iters.in1)
+        for(; (iters.in1 != fromEnd) && ((iters.in2 == toEnd) || (snapshot_order{}(*iters.in1, *iters.in2))); ++iters.in1)
         {
-          if(fs::is_directory(iters.in1->full))
+          if(iters.in1->is_directory())
           {
-            const auto subdir{to / iters.in1->relative};
+            const auto subdir{to / iters.in1->filename()};
             fs::create_directory(subdir);
-            fs::copy(iters.in1->full, subdir, fs::copy_options::recursive);
+            fs::copy(iters.in1->path, subdir, fs::copy_options::recursive);
           }
           else
           {
-            fs::copy(iters.in1->full, to);
+            fs::copy(iters.in1->path, to);
           }
         }
 
         if(iters.in2 != toEnd)
         {
-          while((iters.in2 != toEnd) && compare{}(*iters.in2, *iters.in1))
+          while((iters.in2 != toEnd) && snapshot_order{}(*iters.in2, *iters.in1))
           {
-            fs::remove_all(iters.in2->full);
+            fs::remove_all(iters.in2->path);
             ++iters.in2;
           }
 
-          soft_update(from, to, iters.in1, fromEnd, iters.in2, toEnd);
+          soft_update(to, iters.in1, fromEnd, iters.in2, toEnd);
         }
       }
       else if(iters.in2 != toEnd)
       {
         for(; iters.in2 != toEnd; ++iters.in2)
         {
-          fs::remove_all(iters.in2->full);
+          fs::remove_all(iters.in2->path);
         }
       }
     }
   }
 
-  void soft_update(const fs::path& from, const fs::path& to)
+  void soft_update(const fs::path& from, const fs::path& to, const task_executor& executor)
   {
     throw_unless_exists(from);
     throw_unless_exists(to);
 
-    copy_special_files_back(from, to);
+    copy_special_files_back_recursive(from, to);
 
-    const std::vector<path_info>
-      sortedFromEntries{sort_dir_entries(from)},
-      sortedToEntries{sort_dir_entries(to)};
+    const path_snapshot fromSnapshot{take_snapshot(from, snapshot_detail::types, executor)},
+                        toSnapshot{take_snapshot(to, snapshot_detail::types, executor)};
 
-    soft_update(from, to, sortedFromEntries.begin(), sortedFromEntries.end(), sortedToEntries.begin(), sortedToEntries.end());
+    soft_update(to, fromSnapshot.entries.begin(), fromSnapshot.entries.end(), toSnapshot.entries.begin(), toSnapshot.entries.end());
   }
 
 }
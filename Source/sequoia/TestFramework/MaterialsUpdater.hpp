@@ -11,9 +11,11 @@
     \brief Contains utilities for updating test materials.
  */
 
+#include "sequoia/TestFramework/TaskExecutor.hpp"
+
 #include <filesystem>
 
 namespace sequoia::testing
 {
-  void soft_update(const std::filesystem::path& from, const std::filesystem::path& to);
+  void soft_update(const std::filesystem::path& from, const std::filesystem::path& to, const task_executor& executor = {});
 }
\ No newline at end of file
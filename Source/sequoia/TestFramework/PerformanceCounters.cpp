@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Definitions for PerformanceCounters.hpp
+*/
+
+#include "sequoia/TestFramework/PerformanceCounters.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+namespace sequoia::testing
+{
+  namespace
+  {
+    constexpr int closed_descriptor{-1};
+
+    [[nodiscard]]
+    constexpr std::size_t index(counter_kind kind) noexcept
+    {
+      return static_cast<std::size_t>(kind);
+    }
+
+  #if defined(__linux__)
+    [[nodiscard]]
+    perf_event_attr make_attributes(counter_kind kind) noexcept
+    {
+      perf_event_attr attr{};
+      attr.size           = sizeof(perf_event_attr);
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.type           = PERF_TYPE_HARDWARE;
+      attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      switch(kind)
+      {
+      case counter_kind::instructions:
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case counter_kind::cycles:
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case counter_kind::cache_misses:
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case counter_kind::l1d_read_misses:
+        attr.type   = PERF_TYPE_HW_CACHE;
+        attr.config =    PERF_COUNT_HW_CACHE_L1D
+                      | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                      | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+      case counter_kind::branch_misses:
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case counter_kind::context_switches:
+        // Context switches are kernel events, so must not be excluded
+        attr.type           = PERF_TYPE_SOFTWARE;
+        attr.config         = PERF_COUNT_SW_CONTEXT_SWITCHES;
+        attr.exclude_kernel = 0;
+        break;
+      }
+
+      return attr;
+    }
+
+    /// Opens the counter as a member of the group led by `leader`, or as the leader of a new group
+    [[nodiscard]]
+    int open_counter(counter_kind kind, int leader) noexcept
+    {
+      perf_event_attr attr{make_attributes(kind)};
+      const auto fd{syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0)};
+      return fd >= 0 ? static_cast<int>(fd) : closed_descriptor;
+    }
+
+    /// The layout of a read given PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+    struct counter_value
+    {
+      std::uint64_t value, time_enabled, time_running;
+    };
+  #else
+    [[nodiscard]]
+    int open_counter(counter_kind, int) noexcept
+    {
+      return closed_descriptor;
+    }
+  #endif
+  }
+
+  [[nodiscard]]
+  std::string to_string(counter_kind kind)
+  {
+    switch(kind)
+    {
+    case counter_kind::instructions:
+      return "instructions";
+    case counter_kind::cycles:
+      return "cycles";
+    case counter_kind::cache_misses:
+      return "cache misses";
+    case counter_kind::l1d_read_misses:
+      return "L1d read misses";
+    case counter_kind::branch_misses:
+      return "branch misses";
+    case counter_kind::context_switches:
+      return "context switches";
+    }
+
+    throw std::logic_error{"Unrecognized counter_kind"};
+  }
+
+  counter_group::counter_group(std::initializer_list<counter_kind> kinds)
+    : m_Leader{closed_descriptor}
+  {
+    m_Descriptors.fill(closed_descriptor);
+
+    for(auto kind : kinds)
+    {
+      auto& fd{m_Descriptors[index(kind)]};
+      if(fd == closed_descriptor)
+      {
+        fd = open_counter(kind, m_Leader);
+        if(m_Leader == closed_descriptor) m_Leader = fd;
+      }
+    }
+  }
+
+  counter_group::counter_group(counter_group&& other) noexcept
+    : m_Descriptors{other.m_Descriptors}
+    , m_Leader{other.m_Leader}
+  {
+    other.m_Descriptors.fill(closed_descriptor);
+    other.m_Leader = closed_descriptor;
+  }
+
+  counter_group& counter_group::operator=(counter_group&& other) noexcept
+  {
+    if(this != &other)
+    {
+      close_all();
+      m_Descriptors = other.m_Descriptors;
+      m_Leader      = other.m_Leader;
+      other.m_Descriptors.fill(closed_descriptor);
+      other.m_Leader = closed_descriptor;
+    }
+
+    return *this;
+  }
+
+  counter_group::~counter_group()
+  {
+    close_all();
+  }
+
+  [[nodiscard]]
+  bool counter_group::available(counter_kind kind) const noexcept
+  {
+    return m_Descriptors[index(kind)] != closed_descriptor;
+  }
+
+  [[nodiscard]]
+  bool counter_group::any_available() const noexcept
+  {
+    return std::ranges::any_of(m_Descriptors, [](int fd) { return fd != closed_descriptor; });
+  }
+
+  void counter_group::start()
+  {
+  #if defined(__linux__)
+    if(m_Leader != closed_descriptor)
+    {
+      ioctl(m_Leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(m_Leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+  #endif
+  }
+
+  void counter_group::stop()
+  {
+  #if defined(__linux__)
+    if(m_Leader != closed_descriptor)
+      ioctl(m_Leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  #endif
+  }
+
+  [[nodiscard]]
+  counter_readings counter_group::read() const
+  {
+    counter_readings readings{};
+
+  #if defined(__linux__)
+    for(std::size_t i{}; i < m_Descriptors.size(); ++i)
+    {
+      if(const auto fd{m_Descriptors[i]}; fd != closed_descriptor)
+      {
+        counter_value data{};
+        if((::read(fd, &data, sizeof(data)) == static_cast<ssize_t>(sizeof(data))) && data.time_running)
+        {
+          const auto scale{static_cast<double>(data.time_enabled) / static_cast<double>(data.time_running)};
+          readings[static_cast<counter_kind>(i)] = static_cast<std::uint64_t>(static_cast<double>(data.value) * scale + 0.5);
+        }
+      }
+    }
+  #endif
+
+    return readings;
+  }
+
+  void counter_group::close_all() noexcept
+  {
+  #if defined(__linux__)
+    for(auto& fd : m_Descriptors)
+    {
+      if(fd != closed_descriptor)
+      {
+        ::close(fd);
+        fd = closed_descriptor;
+      }
+    }
+  #endif
+
+    m_Leader = closed_descriptor;
+  }
+}
@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Optional access to hardware performance counters.
+
+    On Linux, counters are obtained via `perf_event_open`. On other platforms, or where the
+    kernel forbids access (see `/proc/sys/kernel/perf_event_paranoid`), every counter is
+    reported as unavailable and clients are expected to degrade gracefully.
+ */
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+
+namespace sequoia::testing
+{
+  enum class counter_kind : std::size_t
+  {
+    instructions,
+    cycles,
+    cache_misses,
+    l1d_read_misses,
+    branch_misses,
+    context_switches
+  };
+
+  inline constexpr std::size_t num_counter_kinds{static_cast<std::size_t>(counter_kind::context_switches) + 1};
+
+  [[nodiscard]]
+  std::string to_string(counter_kind kind);
+
+  /*! \brief The values obtained for each counter; empty optionals indicate unavailability */
+
+  class counter_readings
+  {
+  public:
+    counter_readings() = default;
+
+    [[nodiscard]]
+    const std::optional<std::uint64_t>& operator[](counter_kind kind) const noexcept
+    {
+      return m_Readings[static_cast<std::size_t>(kind)];
+    }
+
+    [[nodiscard]]
+    std::optional<std::uint64_t>& operator[](counter_kind kind) noexcept
+    {
+      return m_Readings[static_cast<std::size_t>(kind)];
+    }
+
+    [[nodiscard]]
+    bool available(counter_kind kind) const noexcept { return (*this)[kind].has_value(); }
+
+    [[nodiscard]]
+    friend bool operator==(const counter_readings&, const counter_readings&) noexcept = default;
+  private:
+    std::array<std::optional<std::uint64_t>, num_counter_kinds> m_Readings{};
+  };
+
+  /*! \brief RAII wrapper around a group of hardware counters.
+
+      Counters which cannot be opened are silently dropped; whether or not a given counter is
+      live may be queried with `available`. Measurements bracket user-space execution of the
+      calling thread only.
+
+      The counters are opened as a single group, so that they are scheduled onto the hardware
+      together. Should the kernel multiplex the group with other events, the readings are
+      scaled by the ratio of the time for which the group was enabled to the time for which it
+      was running; a group which never ran yields no readings.
+   */
+
+  class counter_group
+  {
+  public:
+    counter_group(std::initializer_list<counter_kind> kinds);
+
+    counter_group(const counter_group&) = delete;
+    counter_group(counter_group&& other) noexcept;
+
+    ~counter_group();
+
+    counter_group& operator=(const counter_group&) = delete;
+    counter_group& operator=(counter_group&& other) noexcept;
+
+    [[nodiscard]]
+    bool available(counter_kind kind) const noexcept;
+
+    [[nodiscard]]
+    bool any_available() const noexcept;
+
+    void start();
+
+    void stop();
+
+    [[nodiscard]]
+    counter_readings read() const;
+  private:
+    std::array<int, num_counter_kinds> m_Descriptors;
+    int m_Leader;
+
+    void close_all() noexcept;
+  };
+
+  /*! \brief Runs the task once, bracketed by the requested counters. */
+  template<std::invocable Task>
+  [[nodiscard]]
+  counter_readings measure_counters(Task task, std::initializer_list<counter_kind> kinds)
+  {
+    counter_group group{kinds};
+    group.start();
+    task();
+    group.stop();
+
+    return group.read();
+  }
+}
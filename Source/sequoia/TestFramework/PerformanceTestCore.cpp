@@ -76,25 +76,24 @@ namespace sequoia::testing
   {
     auto summary{base_type::summarize(delta)};
 
-    if constexpr(Mode != test_mode::standard)
-    {
-      const auto referenceOutput{
-        [filename{this->diagnostics_file_paths().false_positive_or_negative_file_path()}]() -> std::string {
-          if(std::filesystem::exists(filename))
-          {
-            if(auto contents{read_to_string(filename)})
-              return contents.value();
+    // Timings are written to the diagnostics output; those which differ from the reference
+    // only within tolerance do not alter it
+    const auto referenceOutput{
+      [filename{this->diagnostics_file_paths().false_positive_or_negative_file_path()}]() -> std::string {
+        if(std::filesystem::exists(filename))
+        {
+          if(auto contents{read_to_string(filename)})
+            return contents.value();
 
-            throw std::runtime_error{report_failed_read(filename)};
-          }
+          throw std::runtime_error{report_failed_read(filename)};
+        }
 
-          return "";
-        }()
-      };
+        return "";
+      }()
+    };
 
-      std::string outputToUse{postprocess(summary.diagnostics_output(), referenceOutput)};
-      summary.diagnostics_output(std::move(outputToUse));
-    }
+    std::string outputToUse{postprocess(summary.diagnostics_output(), referenceOutput)};
+    summary.diagnostics_output(std::move(outputToUse));
 
     return summary;
   }
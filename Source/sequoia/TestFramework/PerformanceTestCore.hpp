@@ -14,6 +14,7 @@
 #include "sequoia/TestFramework/RegularTestCore.hpp"
 #include "sequoia/Maths/Statistics/StatisticalAlgorithms.hpp"
 #include "sequoia/TestFramework/FileEditors.hpp"
+#include "sequoia/TestFramework/PerformanceCounters.hpp"
 
 #include <chrono>
 #include <random>
@@ -32,6 +33,78 @@ namespace sequoia::testing
     return t.time_elapsed();
   }
 
+  namespace impl
+  {
+    struct timing_statistics
+    {
+      double mean{}, sd{};
+    };
+
+    /*! For each trial, both tasks are run in a random order; the statistics exclude
+        the fastest and slowest timings of each task.
+     */
+    template<std::invocable F, std::invocable S>
+    [[nodiscard]]
+    std::pair<timing_statistics, timing_statistics> time_tasks(F& fast, S& slow, const std::size_t trials)
+    {
+      auto timer{
+         [](auto& task, std::vector<double>& timings){
+           timings.push_back(profile(task).count());
+         }
+      };
+
+      std::vector<double> fastData, slowData;
+      fastData.reserve(trials);
+      slowData.reserve(trials);
+
+      std::random_device generator;
+      for(std::size_t i{}; i < trials; ++i)
+      {
+        std::uniform_real_distribution<double> distribution{0.0, 1.0};
+        const bool fastFirst{(distribution(generator) < 0.5)};
+
+        if(fastFirst)
+        {
+          timer(fast, fastData);
+          timer(slow, slowData);
+        }
+        else
+        {
+          timer(slow, slowData);
+          timer(fast, fastData);
+        }
+      }
+
+      auto compute_stats{
+        [](auto first, auto last) {
+          const auto data{maths::sample_standard_deviation(first, last)};
+          return timing_statistics{data.second.value(), data.first.value()};
+        }
+      };
+
+      std::ranges::sort(fastData);
+      std::ranges::sort(slowData);
+
+      return {compute_stats(fastData.cbegin()+1, fastData.cend()-1), compute_stats(slowData.cbegin()+1, slowData.cend()-1)};
+    }
+
+    [[nodiscard]]
+    inline std::string summarize_timings(const timing_statistics& fast, const timing_statistics& slow, const double num_sds)
+    {
+      auto stats{
+        [num_sds](std::string_view prefix, const timing_statistics& data){
+
+          std::ostringstream message{};
+          message << data.mean << "s" << " +- " << num_sds << " * " << data.sd << "s";
+
+          return std::string{prefix}.append(" Task duration: ").append(message.str());
+        }
+      };
+
+      return append_lines(stats("Fast", fast), stats("Slow", slow));
+    }
+  }
+
   /*! \brief Function for comparing the performance of a fast task to a slow task.
 
        \param minSpeedUp  the minimum predicted speed up of fast over slow; must be > 1
@@ -92,57 +165,16 @@ namespace sequoia::testing
     if(trials < 5)
       throw std::logic_error{"Number of trials is required to be > 4"};
 
-    using namespace std::chrono;
-    using namespace maths;
-
     std::string summary{};
     std::size_t remainingAttempts{maxAttempts};
     bool passed{};
 
-    auto timer{
-       [](auto task, std::vector<double>& timings){
-         timings.push_back(profile(task).count());
-       }
-    };
-
     while(remainingAttempts > 0)
     {
       const auto adjustedTrials{trials*(maxAttempts - remainingAttempts + 1)};
-
-      std::vector<double> fastData, slowData;
-      fastData.reserve(adjustedTrials);
-      slowData.reserve(adjustedTrials);
-
-      std::random_device generator;
-      for(std::size_t i{}; i < adjustedTrials; ++i)
-      {
-        std::uniform_real_distribution<double> distribution{0.0, 1.0};
-        const bool fastFirst{(distribution(generator) < 0.5)};
-
-        if(fastFirst)
-        {
-          timer(fast, fastData);
-          timer(slow, slowData);
-        }
-        else
-        {
-          timer(slow, slowData);
-          timer(fast, fastData);
-        }
-      }
-
-      auto compute_stats{
-        [](auto first, auto last) {
-          const auto data{sample_standard_deviation(first, last)};
-          return std::make_pair(data.first.value(), data.second.value());
-        }
-      };
-
-      std::ranges::sort(fastData);
-      std::ranges::sort(slowData);
-
-      const auto [sig_f, m_f]{compute_stats(fastData.cbegin()+1, fastData.cend()-1)};
-      const auto [sig_s, m_s]{compute_stats(slowData.cbegin()+1, slowData.cend()-1)};
+      const auto [fastStats, slowStats]{impl::time_tasks(fast, slow, adjustedTrials)};
+      const auto [m_f, sig_f]{fastStats};
+      const auto [m_s, sig_s]{slowStats};
 
       if(m_f + sig_f < m_s - sig_s)
       {
@@ -162,26 +194,10 @@ namespace sequoia::testing
         passed = false;
       }
 
-      auto stats{
-        [num_sds](std::string_view prefix, const auto mean, const auto sig){
-
-          std::ostringstream message{};
-          message << mean << "s" << " +- " << num_sds << " * " << sig << "s";
-
-          return std::string{prefix}.append(" Task duration: ").append(message.str());
-        }
-      };
-
-      auto summarizer{
-        [m_f, m_s, minSpeedUp, maxSpeedUp](){
-          std::ostringstream message{};
-          message << " [" << m_s / m_f << "; (" << minSpeedUp << ", " << maxSpeedUp << ")]";
-
-          return message.str();
-        }
-      };
+      std::ostringstream message{};
+      message << " [" << m_s / m_f << "; (" << minSpeedUp << ", " << maxSpeedUp << ")]";
 
-      summary = append_lines(stats("Fast", m_f, sig_f), stats("Slow", m_s, sig_s)).append(summarizer());
+      summary = impl::summarize_timings(fastStats, slowStats, num_sds).append(message.str());
 
       if((test_logger<Mode>::mode == test_mode::false_negative) ? !passed : passed)
       {
@@ -202,6 +218,67 @@ namespace sequoia::testing
     return passed;
   }
 
+  /*! \brief Function for reporting, without asserting, the relative performance of two tasks.
+
+       \param trials the number of trials used for the statistical analysis
+
+       The tasks are timed as for check_relative_performance but no check is registered;
+       instead, the durations and the observed speed-up are written to the diagnostics output.
+       This is appropriate where any speed-up depends on hardware, such as the number of cores
+       or NUMA nodes, which cannot be assumed.
+   */
+  template<test_mode Mode, std::invocable F, std::invocable S>
+  void report_relative_performance(std::string_view description, test_logger<Mode>& logger, F fast, S slow, const std::size_t trials)
+  {
+    if(trials < 5)
+      throw std::logic_error{"Number of trials is required to be > 4"};
+
+    const auto [fastStats, slowStats]{impl::time_tasks(fast, slow, trials)};
+
+    std::ostringstream message{};
+    message << " [" << slowStats.mean / fastStats.mean << "]";
+
+    logger.append_to_diagnostics_output(append_lines(description, impl::summarize_timings(fastStats, slowStats, 1).append(message.str())).append("\n\n"));
+  }
+
+  /*! \brief Function for bounding the number of events recorded by a hardware counter.
+
+       \param kind          the hardware counter to inspect
+       \param maxPerElement the maximum permitted number of events per element
+       \param numElements   the number of elements processed by the task; must be > 0
+
+       The task is run once, bracketed by the counter. A check is always registered, so that
+       the number of checks does not depend on the machine. If the counter is unavailable (for
+       example on platforms other than Linux, or if the kernel forbids access) then the check
+       is skipped and the function returns true.
+   */
+  template<test_mode Mode, std::invocable Task>
+  bool check_counter_bound(std::string_view description, test_logger<Mode>& logger, const counter_kind kind, Task task, const double maxPerElement, const std::size_t numElements)
+  {
+    if(!numElements)
+      throw std::logic_error{"Number of elements is required to be > 0"};
+
+    sentinel<Mode> sentry{logger, std::string{description}};
+    sentry.log_performance_check();
+
+    const auto readings{measure_counters(std::move(task), {kind})};
+    if(!readings.available(kind))
+      return true;
+
+    const auto perElement{static_cast<double>(readings[kind].value()) / static_cast<double>(numElements)};
+    const bool passed{perElement <= maxPerElement};
+
+    if(!passed)
+    {
+      std::ostringstream message{};
+      message << "Counter: " << to_string(kind) << " per element: " << perElement << " [<= " << maxPerElement << "]";
+
+      sentry.log_performance_failure(message.str());
+    }
+
+    return passed;
+  }
+
   template<class T, class Period>
   [[nodiscard]]
   std::chrono::duration<T, Period> calibrate(std::chrono::duration<T, Period> target)
@@ -244,6 +321,18 @@ namespace sequoia::testing
     {
       return testing::check_relative_performance(self.report(description), self.m_Logger, fast, slow, minSpeedUp, maxSpeedUp, trials, num_sds, 3);
     }
+
+    template<class Self, std::invocable F, std::invocable S>
+    void report_relative_performance(this Self& self, const reporter& description, F fast, S slow, const std::size_t trials=5)
+    {
+      testing::report_relative_performance(self.report(description), self.m_Logger, fast, slow, trials);
+    }
+
+    template<class Self, std::invocable Task>
+    bool check_counter_bound(this Self& self, const reporter& description, const counter_kind kind, Task task, const double maxPerElement, const std::size_t numElements=1)
+    {
+      return testing::check_counter_bound(self.report(description), self.m_Logger, kind, std::move(task), maxPerElement, numElements);
+    }
   protected:
     ~performance_extender() = default;
 
@@ -289,6 +289,12 @@ namespace sequoia::testing
     return make_path(std::nullopt, ".external");
   }
 
+  [[nodiscard]]
+  std::filesystem::path prune_paths::durations() const
+  {
+    return make_path(std::nullopt, ".durations");
+  }
+
   [[nodiscard]]
   fs::path prune_paths::instability_analysis() const
   {
@@ -365,6 +365,9 @@ namespace sequoia::testing
     [[nodiscard]]
     std::filesystem::path external_dependencies() const;
 
+    [[nodiscard]]
+    std::filesystem::path durations() const;
+
     [[nodiscard]]
     std::filesystem::path instability_analysis() const;
 
@@ -438,6 +441,12 @@ namespace sequoia::testing
     [[nodiscard]]
     static std::filesystem::path instability_analysis(std::filesystem::path projectRoot);
 
+    [[nodiscard]]
+    std::filesystem::path shards() const
+    {
+      return m_TestsTemporaryData / "Shards";
+    }
+
     [[nodiscard]]
     recovery_paths recovery() const
     {
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Definitions for Sharding.hpp
+*/
+
+#include "sequoia/TestFramework/Sharding.hpp"
+#include "sequoia/Streaming/Streaming.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+namespace sequoia::testing
+{
+  namespace fs = std::filesystem;
+
+  namespace
+  {
+    [[nodiscard]]
+    std::optional<std::size_t> to_size(std::string_view text)
+    {
+      std::size_t val{};
+      const auto last{text.data() + text.size()};
+      if(const auto [ptr, ec]{std::from_chars(text.data(), last, val)}; (ec == std::errc{}) && (ptr == last))
+        return val;
+
+      return std::nullopt;
+    }
+  }
+
+  [[nodiscard]]
+  shard_spec parse_shard(std::string_view spec)
+  {
+    if(const auto pos{spec.find('/')}; pos != std::string_view::npos)
+    {
+      const auto index{to_size(spec.substr(0, pos))}, count{to_size(spec.substr(pos + 1))};
+      if(index && count && (*index < *count))
+        return {.index{*index}, .count{*count}};
+    }
+
+    throw std::runtime_error{std::string{"shard: unable to interpret '"}.append(spec).append("' as i/N with 0 <= i < N")};
+  }
+
+  [[nodiscard]]
+  std::string to_string(const shard_spec& spec)
+  {
+    return std::to_string(spec.index).append("/").append(std::to_string(spec.count));
+  }
+
+  [[nodiscard]]
+  std::vector<std::size_t> balance_shards(std::span<const log_summary::duration> weights, std::size_t numShards)
+  {
+    if(!numShards)
+      throw std::logic_error{"balance_shards: number of shards must be non-zero"};
+
+    std::vector<std::size_t> order(weights.size());
+    std::iota(order.begin(), order.end(), std::size_t{});
+    std::ranges::stable_sort(order, std::ranges::greater{}, [weights](std::size_t i) { return weights[i]; });
+
+    std::vector<log_summary::duration> loads(numShards);
+    std::vector<std::size_t> shards(weights.size());
+    for(auto i : order)
+    {
+      const auto lightest{std::ranges::min_element(loads)};
+      *lightest += weights[i];
+      shards[i] = static_cast<std::size_t>(std::ranges::distance(loads.begin(), lightest));
+    }
+
+    return shards;
+  }
+
+  [[nodiscard]]
+  test_duration_history read_test_durations(const fs::path& file)
+  {
+    test_duration_history history{};
+    if(std::ifstream ifile{file})
+    {
+      std::string line{};
+      while(std::getline(ifile, line))
+      {
+        const auto first{line.find('\t')};
+        const auto second{first != std::string::npos ? line.find('\t', first + 1) : std::string::npos};
+        if(second == std::string::npos) continue;
+
+        long long count{};
+        const auto last{line.data() + first};
+        if(const auto [ptr, ec]{std::from_chars(line.data(), last, count)}; (ec == std::errc{}) && (ptr == last))
+        {
+          history.insert_or_assign(test_identity{line.substr(first + 1, second - first - 1), line.substr(second + 1)},
+                                   log_summary::duration{count});
+        }
+      }
+    }
+
+    return history;
+  }
+
+  void update_test_durations(const fs::path& file, const test_duration_history& durations)
+  {
+    if(durations.empty()) return;
+
+    auto history{read_test_durations(file)};
+    for(const auto& [id, duration] : durations)
+      history.insert_or_assign(id, duration);
+
+    if(std::ofstream ofile{file})
+    {
+      for(const auto& [id, duration] : history)
+        ofile << duration.count() << '\t' << id.source << '\t' << id.name << '\n';
+    }
+    else
+    {
+      throw std::runtime_error{report_failed_write(file)};
+    }
+  }
+
+  std::ostream& operator<<(std::ostream& s, const shard_record& record)
+  {
+    return s << "$Source: " << std::quoted(record.source) << '\n' << record.summary;
+  }
+
+  std::istream& operator>>(std::istream& s, shard_record& record)
+  {
+    std::string tag{};
+    if(!(s >> tag)) return s;
+
+    if(tag != "$Source:")
+      throw std::runtime_error{"Error while parsing shard_record: unable to find $Source:"};
+
+    shard_record parsed{};
+    if(s >> std::quoted(parsed.source) >> parsed.summary)
+      record = std::move(parsed);
+
+    return s;
+  }
+
+  void append_shard_record(const fs::path& file, const shard_record& record)
+  {
+    if(std::ofstream ofile{file, std::ios_base::app})
+    {
+      ofile << record << std::flush;
+    }
+    else
+    {
+      throw std::runtime_error{report_failed_write(file)};
+    }
+  }
+
+  [[nodiscard]]
+  std::vector<shard_record> read_shard_records(const fs::path& file)
+  {
+    std::vector<shard_record> records{};
+    if(std::ifstream ifile{file})
+    {
+      try
+      {
+        for(shard_record record{}; ifile >> record;)
+          records.push_back(std::move(record));
+      }
+      catch(const std::runtime_error&)
+      {
+        // The shard terminated part way through writing a record
+      }
+    }
+
+    return records;
+  }
+}
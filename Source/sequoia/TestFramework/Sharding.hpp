@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Utilities for splitting a test run into disjoint shards.
+
+    Shards are balanced using the durations recorded by previous runs. Tests sharing a
+    source file always land in the same shard, since they share materials. A shard which
+    runs in a child process reports each test's summary to a file, from which the
+    coordinating process reconstructs the results.
+ */
+
+#include "sequoia/TestFramework/TestLogger.hpp"
+
+#include <map>
+#include <span>
+#include <vector>
+
+namespace sequoia::testing
+{
+  /*! \brief Identifies the shard with zero-based `index` of `count` disjoint shards */
+  struct shard_spec
+  {
+    std::size_t index{}, count{1};
+
+    [[nodiscard]]
+    bool partitioned() const noexcept { return count > 1; }
+
+    [[nodiscard]]
+    friend bool operator==(const shard_spec&, const shard_spec&) noexcept = default;
+  };
+
+  /*! \brief Parses text of the form "i/N", where 0 <= i < N; throws if this is not possible */
+  [[nodiscard]]
+  shard_spec parse_shard(std::string_view spec);
+
+  [[nodiscard]]
+  std::string to_string(const shard_spec& spec);
+
+  /*! \brief Assigns each weight to a shard, heaviest first, so as to even out the total load.
+
+      The return value holds the shard of each weight. Ties are broken by position,
+      so the result is deterministic.
+   */
+  [[nodiscard]]
+  std::vector<std::size_t> balance_shards(std::span<const log_summary::duration> weights, std::size_t numShards);
+
+  /*! \brief Identifies a test by the source file, relative to the test repository, and the test name */
+  struct test_identity
+  {
+    std::string source, name;
+
+    [[nodiscard]]
+    friend auto operator<=>(const test_identity&, const test_identity&) noexcept = default;
+  };
+
+  using test_duration_history = std::map<test_identity, log_summary::duration>;
+
+  [[nodiscard]]
+  test_duration_history read_test_durations(const std::filesystem::path& file);
+
+  /*! \brief Merges `durations` into those recorded in `file`, overwriting any for the same tests */
+  void update_test_durations(const std::filesystem::path& file, const test_duration_history& durations);
+
+  struct shard_record
+  {
+    std::string source;
+    log_summary summary;
+  };
+
+  std::ostream& operator<<(std::ostream& s, const shard_record& record);
+
+  std::istream& operator>>(std::istream& s, shard_record& record);
+
+  void append_shard_record(const std::filesystem::path& file, const shard_record& record);
+
+  /*! \brief Reads all complete records; a record truncated by a crashed shard is ignored */
+  [[nodiscard]]
+  std::vector<shard_record> read_shard_records(const std::filesystem::path& file);
+}
@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief Statistics gathered while staging test materials.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace sequoia::testing
+{
+  struct staging_statistics
+  {
+    using duration = std::chrono::steady_clock::duration;
+
+    std::uintmax_t bytes_copied{}, bytes_cloned{}, bytes_linked{};
+    std::size_t files{};
+    duration time{};
+
+    [[nodiscard]]
+    std::uintmax_t total_bytes() const noexcept { return bytes_copied + bytes_cloned + bytes_linked; }
+
+    staging_statistics& operator+=(const staging_statistics& rhs) noexcept;
+
+    [[nodiscard]]
+    friend bool operator==(const staging_statistics&, const staging_statistics&) noexcept = default;
+  };
+}
@@ -27,6 +27,24 @@ namespace sequoia::testing
       ss << std::setprecision(3) << duration_cast<duration<double, Period>>(d).count();
       return ss.str();
     }
+
+    [[nodiscard]]
+    std::string stringify_bytes(const std::uintmax_t bytes)
+    {
+      constexpr std::array<std::string_view, 4> units{"B", "kB", "MB", "GB"};
+
+      auto value{static_cast<double>(bytes)};
+      std::size_t i{};
+      while((value >= 1000.0) && (i + 1 < units.size()))
+      {
+        value /= 1000.0;
+        ++i;
+      }
+
+      std::stringstream ss{};
+      ss << std::setprecision(3) << value << units[i];
+      return ss.str();
+    }
   }
 
   [[nodiscard]]
@@ -57,6 +75,21 @@ namespace sequoia::testing
     return mess;
   }
 
+  [[nodiscard]]
+  std::string report_staging(const log_summary& log)
+  {
+    const auto& stats{log.materials_staging()};
+    if(!stats.files) return "";
+
+    const auto [dur, unit]{stringify(stats.time)};
+    return std::string{"[Materials Staging: "}.append(dur).append(unit)
+      .append("; Files: ").append(std::to_string(stats.files))
+      .append("; Copied: ").append(stringify_bytes(stats.bytes_copied))
+      .append("; Cloned: ").append(stringify_bytes(stats.bytes_cloned))
+      .append("; Linked: ").append(stringify_bytes(stats.bytes_linked))
+      .append("]\n");
+  }
+
   [[nodiscard]]
   std::string summarize(const log_summary& log, std::string_view namesuffix, const opt_duration duration, const summary_detail verbosity, indentation ind_0, indentation ind_1)
   {
@@ -129,6 +162,11 @@ namespace sequoia::testing
       summary.append("\n");
     }
 
+    if((verbosity & summary_detail::materials_staging) == summary_detail::materials_staging)
+    {
+      summary.append(sequoia::indent(report_staging(log), ind_0));
+    }
+
     if((verbosity & summary_detail::absent_checks) == summary_detail::absent_checks)
     {
       std::ranges::for_each(summaries, [&summary](const std::string& s){ (summary += s) += "\n"; } );
@@ -19,7 +19,7 @@
 namespace sequoia::testing
 {
   /*! bit mask for the level of detail */
-  enum class summary_detail { none=0, absent_checks=1, failure_messages=2, timings=4};
+  enum class summary_detail { none=0, absent_checks=1, failure_messages=2, timings=4, materials_staging=8};
 }
 
 NAMESPACE_SEQUOIA_AS_BITMASK
@@ -70,6 +70,9 @@ namespace sequoia::testing
   [[nodiscard]]
   std::string report_time(const log_summary& log, opt_duration duration);
 
+  [[nodiscard]]
+  std::string report_staging(const log_summary& log);
+
   [[nodiscard]]
   std::string summarize(const log_summary& log, std::string_view namesuffix, opt_duration duration, const summary_detail verbosity, indentation ind_0, indentation ind_1);
 
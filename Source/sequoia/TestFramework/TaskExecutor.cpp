@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file
+    \brief Definitions for TaskExecutor.hpp
+*/
+
+#include "sequoia/TestFramework/TaskExecutor.hpp"
+
+#include <atomic>
+
+namespace sequoia::testing
+{
+  namespace
+  {
+    thread_local bool worker_thread{};
+  }
+
+  struct task_executor::state
+  {
+    state(std::size_t numThreads, thread_affinity a)
+      : pool{numThreads}
+      , num_threads{numThreads}
+      , affinity{a}
+    {}
+
+    concurrency::thread_pool<void> pool;
+    std::size_t num_threads;
+    thread_affinity affinity;
+    std::atomic<std::size_t> next_core{};
+    std::mutex push_mutex{};
+  };
+
+  task_executor::task_executor() noexcept = default;
+
+  task_executor::task_executor(std::size_t numThreads, thread_affinity affinity)
+    : m_pState{numThreads ? std::make_unique<state>(numThreads, affinity) : nullptr}
+  {}
+
+  task_executor::task_executor(task_executor&&) noexcept = default;
+
+  task_executor& task_executor::operator=(task_executor&&) noexcept = default;
+
+  task_executor::~task_executor() = default;
+
+  [[nodiscard]]
+  std::size_t task_executor::num_threads() const noexcept
+  {
+    return m_pState ? m_pState->num_threads : 0;
+  }
+
+  [[nodiscard]]
+  bool task_executor::on_worker_thread() noexcept
+  {
+    return worker_thread;
+  }
+
+  void task_executor::enter_worker() const
+  {
+    if(worker_thread) return;
+
+    worker_thread = true;
+    if(m_pState->affinity == thread_affinity::pinned)
+      pin_current_thread(m_pState->next_core++);
+  }
+
+  [[nodiscard]]
+  std::unique_lock<std::mutex> task_executor::acquire() const
+  {
+    return std::unique_lock{m_pState->push_mutex};
+  }
+
+  [[nodiscard]]
+  concurrency::thread_pool<void>& task_executor::pool() const noexcept
+  {
+    return m_pState->pool;
+  }
+
+  bool pin_current_thread(std::size_t core) noexcept
+  {
+    const auto numCores{std::thread::hardware_concurrency()};
+    if(!numCores) return false;
+
+    core %= numCores;
+    return concurrency::pin_current_thread(std::span{&core, 1});
+  }
+}
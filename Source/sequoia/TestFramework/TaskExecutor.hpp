@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file
+    \brief A long-lived executor shared by all phases of a test run.
+
+    Dependency analysis, materials staging, test execution and file updates all distribute
+    their work over the same pool of threads, which is started once per run. Work submitted
+    from within one of the pool's own threads is executed inline, so that nested parallelism
+    can never deadlock the pool.
+ */
+
+#include "sequoia/Core/Concurrency/ConcurrencyModels.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <ranges>
+#include <vector>
+
+namespace sequoia::testing
+{
+  enum class thread_affinity {
+    none,  /// threads are placed by the operating system
+    pinned /// each thread is pinned to a distinct core, where the platform supports this
+  };
+
+  class task_executor
+  {
+  public:
+    /*! \brief Constructs an executor which runs everything serially on the calling thread */
+    task_executor() noexcept;
+
+    task_executor(std::size_t numThreads, thread_affinity affinity);
+
+    task_executor(const task_executor&) = delete;
+    task_executor(task_executor&&) noexcept;
+
+    task_executor& operator=(const task_executor&) = delete;
+    task_executor& operator=(task_executor&&) noexcept;
+
+    ~task_executor();
+
+    [[nodiscard]]
+    std::size_t num_threads() const noexcept;
+
+    /*! \brief Invokes `fn` on each element of `r`, returning once all invocations are complete.
+
+        `fn` may be invoked concurrently. If any invocation throws, the first exception
+        is rethrown once all invocations have finished. Likewise, if an invocation cannot
+        be submitted, the exception is propagated only once those submitted have finished.
+     */
+    template<std::ranges::forward_range R, class Fn>
+    void for_each(R&& r, Fn fn) const
+    {
+      if(!m_pState || on_worker_thread() || (std::ranges::distance(r) < 2))
+      {
+        std::ranges::for_each(r, fn);
+        return;
+      }
+
+      std::vector<std::future<void>> futures{};
+      futures.reserve(static_cast<std::size_t>(std::ranges::distance(r)));
+
+      // Tasks already pushed refer to fn, so must finish before unwinding if a subsequent push throws
+      struct wait_on_exit
+      {
+        std::vector<std::future<void>>& futures;
+
+        ~wait_on_exit()
+        {
+          for(auto& f : futures)
+          {
+            if(f.valid()) f.wait();
+          }
+        }
+      } guard{futures};
+
+      {
+        auto lock{acquire()};
+        for(auto i{std::ranges::begin(r)}; i != std::ranges::end(r); ++i)
+        {
+          futures.push_back(pool().push([this, i, &fn]() {
+            enter_worker();
+            fn(*i);
+          }));
+        }
+      }
+
+      std::exception_ptr error{};
+      for(auto& f : futures)
+      {
+        try
+        {
+          f.get();
+        }
+        catch(...)
+        {
+          if(!error) error = std::current_exception();
+        }
+      }
+
+      if(error) std::rethrow_exception(error);
+    }
+  private:
+    struct state;
+
+    std::unique_ptr<state> m_pState{};
+
+    [[nodiscard]]
+    static bool on_worker_thread() noexcept;
+
+    void enter_worker() const;
+
+    [[nodiscard]]
+    std::unique_lock<std::mutex> acquire() const;
+
+    [[nodiscard]]
+    concurrency::thread_pool<void>& pool() const noexcept;
+  };
+
+  /*! \brief Pins the calling thread to the core with the given index, modulo the number of cores.
+
+      Returns false if this is not supported by the platform or fails.
+   */
+  bool pin_current_thread(std::size_t core) noexcept;
+}
@@ -12,6 +12,7 @@
 #include "sequoia/TestFramework/TestLogger.hpp"
 
 #include <fstream>
+#include <iomanip>
 
 namespace sequoia::testing
 {
@@ -343,6 +344,7 @@ namespace sequoia::testing
     m_CriticalFailures   += rhs.m_CriticalFailures;
     m_ExceptionsInFlight += rhs.m_ExceptionsInFlight;
     m_Duration           += rhs.m_Duration;
+    m_Staging            += rhs.m_Staging;
 
     return *this;
   }
@@ -353,4 +355,86 @@ namespace sequoia::testing
     log_summary s{lhs};
     return s += rhs;
   }
+
+  std::ostream& operator<<(std::ostream& s, const log_summary& summary)
+  {
+    s << "$Summary: " << std::quoted(summary.m_Name) << '\n'
+      << std::quoted(summary.m_FailureMessages) << '\n'
+      << std::quoted(summary.m_DiagnosticsOutput) << '\n'
+      << std::quoted(summary.m_CaughtExceptionMessages) << '\n';
+
+    s << summary.m_StandardTopLevelChecks         << ' '
+      << summary.m_StandardDeepChecks             << ' '
+      << summary.m_StandardPerformanceChecks      << ' '
+      << summary.m_FalsePositiveChecks            << ' '
+      << summary.m_FalseNegativeChecks            << ' '
+      << summary.m_FalsePositivePerformanceChecks << ' '
+      << summary.m_FalseNegativePerformanceChecks << '\n';
+
+    s << summary.m_StandardTopLevelFailures         << ' '
+      << summary.m_StandardDeepFailures             << ' '
+      << summary.m_StandardPerformanceFailures      << ' '
+      << summary.m_FalsePositiveFailures            << ' '
+      << summary.m_FalseNegativeFailures            << ' '
+      << summary.m_FalsePositivePerformanceFailures << ' '
+      << summary.m_FalseNegativePerformanceFailures << ' '
+      << summary.m_CriticalFailures                 << ' '
+      << summary.m_ExceptionsInFlight               << '\n';
+
+    const auto& staging{summary.m_Staging};
+    s << summary.m_Duration.count() << ' '
+      << staging.bytes_copied << ' ' << staging.bytes_cloned << ' ' << staging.bytes_linked << ' '
+      << staging.files << ' ' << staging.time.count() << "\n$\n";
+
+    return s;
+  }
+
+  std::istream& operator>>(std::istream& s, log_summary& summary)
+  {
+    std::string tag{};
+    if(!(s >> tag)) return s;
+
+    if(tag != "$Summary:")
+      throw std::runtime_error{"Error while parsing log_summary: unable to find $Summary:"};
+
+    log_summary parsed{};
+    s >> std::quoted(parsed.m_Name)
+      >> std::quoted(parsed.m_FailureMessages)
+      >> std::quoted(parsed.m_DiagnosticsOutput)
+      >> std::quoted(parsed.m_CaughtExceptionMessages);
+
+    s >> parsed.m_StandardTopLevelChecks
+      >> parsed.m_StandardDeepChecks
+      >> parsed.m_StandardPerformanceChecks
+      >> parsed.m_FalsePositiveChecks
+      >> parsed.m_FalseNegativeChecks
+      >> parsed.m_FalsePositivePerformanceChecks
+      >> parsed.m_FalseNegativePerformanceChecks;
+
+    s >> parsed.m_StandardTopLevelFailures
+      >> parsed.m_StandardDeepFailures
+      >> parsed.m_StandardPerformanceFailures
+      >> parsed.m_FalsePositiveFailures
+      >> parsed.m_FalseNegativeFailures
+      >> parsed.m_FalsePositivePerformanceFailures
+      >> parsed.m_FalseNegativePerformanceFailures
+      >> parsed.m_CriticalFailures
+      >> parsed.m_ExceptionsInFlight;
+
+    log_summary::duration::rep duration{}, stagingTime{};
+    auto& staging{parsed.m_Staging};
+    s >> duration >> staging.bytes_copied >> staging.bytes_cloned >> staging.bytes_linked >> staging.files >> stagingTime;
+
+    if(s >> tag; s.fail() || (tag != "$"))
+    {
+      s.setstate(std::ios_base::failbit);
+      return s;
+    }
+
+    parsed.m_Duration = log_summary::duration{duration};
+    staging.time      = staging_statistics::duration{stagingTime};
+    summary = std::move(parsed);
+
+    return s;
+  }
 }
@@ -22,6 +22,7 @@
 #include "sequoia/Core/Meta/TypeTraits.hpp"
 #include "sequoia/TestFramework/FailureInfo.hpp"
 #include "sequoia/TestFramework/Output.hpp"
+#include "sequoia/TestFramework/StagingStatistics.hpp"
 #include "sequoia/TestFramework/TestMode.hpp"
 
 #include <chrono>
@@ -88,6 +89,8 @@ namespace sequoia::testing
 
     void recovery(active_recovery_files paths) { m_Recovery = std::move(paths); }
 
+    void append_to_diagnostics_output(std::string message);
+
     [[nodiscard]]
     std::string_view top_level_message() const noexcept
     {
@@ -158,8 +161,6 @@ namespace sequoia::testing
 
     void log_caught_exception_message(std::string_view message);
 
-    void append_to_diagnostics_output(std::string message);
-
     void increment_depth(std::string_view message);
 
     void decrement_depth();
@@ -375,6 +376,11 @@ namespace sequoia::testing
 
     void execution_time(const duration delta) { m_Duration = delta; }
 
+    [[nodiscard]]
+    const staging_statistics& materials_staging() const noexcept { return m_Staging; }
+
+    void materials_staging(const staging_statistics& stats) noexcept { m_Staging = stats; }
+
     log_summary& operator+=(const log_summary& rhs);
 
     [[nodiscard]]
@@ -384,6 +390,11 @@ namespace sequoia::testing
     const std::string& failure_messages() const noexcept { return m_FailureMessages; }
 
     friend log_summary operator+(const log_summary& lhs, const log_summary& rhs);
+
+    /*! \brief Serializes the summary, such that it may be faithfully reconstructed by operator>> */
+    friend std::ostream& operator<<(std::ostream& s, const log_summary& summary);
+
+    friend std::istream& operator>>(std::istream& s, log_summary& summary);
   private:
     std::string
       m_Name,
@@ -412,6 +423,8 @@ namespace sequoia::testing
 
     duration m_Duration{};
 
+    staging_statistics m_Staging{};
+
     log_summary(std::string_view name, const test_logger_base& logger, test_mode mode, const duration delta);
   };
 }
@@ -24,6 +24,7 @@
 #include "sequoia/TextProcessing/Substitutions.hpp"
 
 #include <fstream>
+#include <thread>
 
 namespace sequoia::testing
 {
@@ -34,49 +35,32 @@ namespace sequoia::testing
     const auto entry_time_stamp{std::chrono::file_clock::now()};
 
     [[nodiscard]]
-    std::string running_tests_message(concurrency_mode mode)
+    std::string running_tests_message(concurrency_mode mode, std::size_t numProcesses)
     {
       std::string mess{"\nRunning tests"};
-      if(mode == concurrency_mode::serial) mess.append(", synchronously");
+      if(numProcesses > 1)                      mess.append(" across ").append(std::to_string(numProcesses)).append(" processes");
+      else if(mode == concurrency_mode::serial) mess.append(", synchronously");
 
       return mess.append("...\n\n");
     }
 
-    struct thread_pool_policy
-    {
-      std::size_t num{8};
-    };
-
-    template<class Weight, class UnaryFn>
-    void accelerate(thread_pool_policy p, std::span<Weight> weights, UnaryFn fn)
+    [[nodiscard]]
+    task_executor make_executor(concurrency_mode mode, std::size_t poolSize, thread_affinity affinity)
     {
-      if(const auto num{weights.size()}; num > 1)
+      switch(mode)
       {
-        concurrency::thread_pool<void> pool{std::ranges::min(num, p.num)};
-        auto futures{
-              std::views::transform(weights, [&pool, fn](auto& wt){ return pool.push([&wt, fn](){ return fn(wt); }); })
-            | std::ranges::to<std::vector>()
-        };
+      case concurrency_mode::serial:
+        return {};
+      case concurrency_mode::dynamic:
+        if(const auto num{std::thread::hardware_concurrency()}; num > 0)
+          return {num, affinity};
 
-        for(auto& f : futures) f.get();
-      }
-      else if(num > 0)
-      {
-        fn(weights.front());
+        return {poolSize, affinity};
+      case concurrency_mode::fixed:
+        return {poolSize, affinity};
       }
-    }
 
-    template<class ExecutionPolicy, class Weight, class UnaryFn>
-    void accelerate(ExecutionPolicy&& policy, std::span<Weight> weights, UnaryFn f)
-    {
-      if constexpr(!with_clang_v)
-      {
-        std::for_each(std::forward<ExecutionPolicy>(policy), weights.begin(), weights.end(), std::move(f));
-      }
-      else
-      {
-        accelerate(thread_pool_policy{.num{8}}, weights, std::move(f));
-      }
+      throw std::logic_error{"Illegal option for concurrency_mode"};
     }
 
     struct test_paths
@@ -170,6 +154,79 @@ namespace sequoia::testing
       throw std::logic_error{"Illegal option for concurrency_mode"};
     }
 
+    [[nodiscard]]
+    std::string to_staging_option(staging_mode mode)
+    {
+      switch(mode)
+      {
+      case staging_mode::copy:
+        return " --materials-staging copy";
+      case staging_mode::clone:
+        return "";
+      case staging_mode::link:
+        return " --materials-staging link";
+      }
+
+      throw std::logic_error{"Illegal option for staging_mode"};
+    }
+
+    template<class Filter>
+    [[nodiscard]]
+    std::string to_selection_options(const Filter& filter)
+    {
+      std::string srcs{};
+
+      if(auto items{filter.selected_items()})
+      {
+        for(const auto&[file, found] : *items)
+        {
+          if(found) srcs.append(" select " + file.path().generic_string());
+        }
+      }
+
+      if(auto suites{filter.selected_suites()})
+      {
+        for(const auto&[name, found] : *suites)
+        {
+          if(found) srcs.append(" test " + name);
+        }
+      }
+
+      return srcs;
+    }
+
+    [[nodiscard]]
+    fs::path shard_output(const fs::path& shardsDir, std::size_t i)
+    {
+      return shardsDir / ("Shard" + std::to_string(i) + ".txt");
+    }
+
+    [[nodiscard]]
+    fs::path shard_log(const fs::path& shardsDir, std::size_t i)
+    {
+      return shardsDir / ("Shard" + std::to_string(i) + "Log.txt");
+    }
+
+    [[nodiscard]]
+    test_identity make_identity(const test_vessel& test, const project_paths& projPaths)
+    {
+      return {rebase_from(test.source_file(), projPaths.tests().repo()).generic_string(), test.name()};
+    }
+
+    [[nodiscard]]
+    log_summary unreported_summary(const test_vessel& test, const fs::path& shardsDir)
+    {
+      test_logger<test_mode::standard> logger{};
+      {
+        sentinel<test_mode::standard> sentry{logger, ""};
+        sentry.log_critical_failure(std::string{"No results reported for \""}.append(test.name())
+                                      .append("\": the process running it terminated abnormally.\nSee the logs in ")
+                                      .append(shardsDir.generic_string()));
+      }
+
+      return log_summary{test.name(), logger, {}};
+    }
+
     const std::string& convert(const std::string& s) { return s; }
     std::string convert(const std::filesystem::path& p) { return p.generic_string(); }
 
@@ -178,22 +235,27 @@ namespace sequoia::testing
     class test_tracker
     {
     public:
-      explicit test_tracker(const project_paths& projPaths, std::optional<std::size_t> id, is_filtered isFiltered)
+      test_tracker(const project_paths& projPaths,
+                   std::optional<std::size_t> id,
+                   is_filtered isFiltered,
+                   std::filesystem::path shardOutput,
+                   const task_executor& executor)
         : m_ProjPaths{projPaths}
         , m_Id{id}
         , m_Filtered{isFiltered}
+        , m_ShardOutput{std::move(shardOutput)}
+        , m_Executor{&executor}
       {}
 
       void increment_depth() noexcept { ++m_Depth; }
 
       void decrement_depth() noexcept
       {
-        if(--m_Depth == npos)
+        if((--m_Depth == npos) && m_ShardOutput.empty())
         {
-          for(const auto& update : m_Updateables)
-          {
-            soft_update(update.working_materials, update.predictions);
-          }
+          m_Executor->for_each(m_Updateables, [executor{m_Executor}](const test_paths& update) {
+            soft_update(update.working_materials, update.predictions, *executor);
+          });
 
           update_prune_info();
         }
@@ -201,6 +263,13 @@ namespace sequoia::testing
 
       void process_test(const test_paths& files, const log_summary& summary, update_mode updateMode)
       {
+        if(!m_ShardOutput.empty())
+        {
+          // The coordinating process deals with summaries, materials updates and pruning
+          append_shard_record(m_ShardOutput, {files.test_file.generic_string(), summary});
+          return;
+        }
+
         m_ExecutedTests.push_back(files.test_file);
 
         if(summary.soft_failures() || summary.critical_failures())
@@ -226,6 +295,8 @@ namespace sequoia::testing
       project_paths m_ProjPaths;
       std::optional<std::size_t> m_Id{};
       is_filtered m_Filtered{};
+      std::filesystem::path m_ShardOutput{};
+      const task_executor* m_Executor;
 
       std::vector<std::filesystem::path> m_FailedTests{}, m_ExecutedTests{};
       std::set<test_paths, paths_comparator> m_Updateables{};
@@ -272,11 +343,17 @@ namespace sequoia::testing
     };
   }
 
-  individual_materials_paths set_materials(const std::filesystem::path& sourceFile, const project_paths& projPaths, std::vector<std::filesystem::path>& materialsPaths)
+  [[nodiscard]]
+  staged_materials stage_materials(const std::filesystem::path& sourceFile,
+                                   const project_paths& projPaths,
+                                   std::vector<std::filesystem::path>& materialsPaths,
+                                   staging_mode mode,
+                                   const task_executor& executor)
   {
     individual_materials_paths materials{sourceFile, projPaths};
     if(!fs::exists(materials.original_materials())) return {};
 
+    staging_statistics stats{};
     const auto workingCopy{materials.working()};
     if(std::ranges::find(materialsPaths, workingCopy) == materialsPaths.cend())
     {
@@ -285,7 +362,7 @@ namespace sequoia::testing
 
       if(const auto originalWorking{materials.original_working()}; fs::exists(originalWorking))
       {
-        fs::copy(originalWorking, workingCopy, fs::copy_options::recursive | fs::copy_options::overwrite_existing);
+        stats += stage_directory(originalWorking, workingCopy, working_staging(mode), executor);
       }
       else
       {
@@ -294,13 +371,28 @@ namespace sequoia::testing
 
       if(const auto originalAux{materials.original_auxiliary()}; fs::exists(originalAux))
       {
-        fs::copy(originalAux, materials.auxiliary(), fs::copy_options::recursive | fs::copy_options::overwrite_existing);
+        stats += stage_directory(originalAux, materials.auxiliary(), auxiliary_staging(mode), executor);
       }
 
       materialsPaths.emplace_back(workingCopy);
     }
 
-    return materials;
+    return {std::move(materials), stats};
+  }
+
+  [[nodiscard]]
+  individual_materials_paths locate_materials(const std::filesystem::path& sourceFile, const project_paths& projPaths)
+  {
+    individual_materials_paths materials{sourceFile, projPaths};
+    return fs::exists(materials.original_materials()) ? materials : individual_materials_paths{};
+  }
+
+  individual_materials_paths set_materials(const std::filesystem::path& sourceFile,
+                                           const project_paths& projPaths,
+                                           std::vector<std::filesystem::path>& materialsPaths,
+                                           staging_mode mode)
+  {
+    return stage_materials(sourceFile, projPaths, materialsPaths, mode).paths;
   }
 
 
@@ -622,6 +714,41 @@ namespace sequoia::testing
                       }
                     }
                   }}},
+                  {{{"--pin-threads", {}, {}, [this](const arg_list&) { m_Affinity = thread_affinity::pinned; }}}},
+                  {{{"--shard", {}, {"i/N"},
+                    [this](const arg_list& args) {
+                      m_Shard = parse_shard(args.front());
+                    },
+                    {}},
+                    { {{"--shard-output", {}, {"private option, best avoided"},
+                        [this](const arg_list& args) {
+                          m_ShardOutput = args.front();
+                        }}}
+                    }
+                  }},
+                  {{{"--processes", {}, {"Number of processes, must be >= 1"},
+                    [this](const arg_list& args) {
+                      if(const auto num{std::stoi(args.front())}; num > 0)
+                      {
+                        m_NumProcesses = num;
+                      }
+                      else
+                      {
+                        stream() << warning(std::string{"Number of processes must be non-zero"});
+                      }
+                    }
+                  }}},
+                  {{{"--materials-staging", {}, {"copy | clone | link"},
+                    [this](const arg_list& args) {
+                      const auto& mode{args.front()};
+                      if(mode == "copy")       m_StagingMode = staging_mode::copy;
+                      else if(mode == "clone") m_StagingMode = staging_mode::clone;
+                      else if(mode == "link")  m_StagingMode = staging_mode::link;
+                      else
+                        stream() << warning(std::string{"Unrecognized materials staging mode: "}.append(mode));
+                    }
+                  }}},
+                  {{{"--report-staging", {}, {}, [this](const arg_list&) { m_StagingDetail = summary_detail::materials_staging; }}}},
                   {{{"--verbose",  {"-v"}, {}, [this](const arg_list&) { m_OutputMode = output_mode::verbose; }}}}
                 },
                 [](std::string_view){})
@@ -639,6 +766,8 @@ namespace sequoia::testing
 
       check_argument_consistency();
 
+      m_Executor = make_executor(m_ConcurrencyMode, m_PoolSize, m_Affinity);
+
       if(in_mode(runner_mode::create))
         stream() << '\n' << cmake_nascent_tests(proj_paths());
   
@@ -672,6 +801,15 @@ namespace sequoia::testing
     if((m_ConcurrencyMode != concurrency_mode::serial) && (m_RecoveryMode != recovery_mode::none))
       throw std::runtime_error{error("Can't run asynchronously in recovery/dump mode\n")};
 
+    if((m_InstabilityMode != instability_mode::none) && (m_Shard.partitioned() || multi_process()))
+      throw std::runtime_error{error("Can't shard tests while locating instabilities\n")};
+
+    if(multi_process() && (m_RecoveryMode != recovery_mode::none))
+      throw std::runtime_error{error("Can't run across multiple processes in recovery/dump mode\n")};
+
+    if(multi_process() && m_Shard.partitioned())
+      throw std::runtime_error{error("'--shard' and '--processes' may not be combined\n")};
+
     if((m_PruneInfo.mode == prune_mode::active) && m_Filter)
     {
       m_PruneInfo.mode = prune_mode::passive;
@@ -743,29 +881,7 @@ namespace sequoia::testing
       if(proj_paths().executable().empty())
         throw std::runtime_error{"Unable to run in sandbox mode, as executable cannot be found"};
 
-      const auto specified{
-        [&filter=m_Filter] () -> std::string {
-          std::string srcs{};
-
-          if(auto items{filter.selected_items()})
-          {
-            for(const auto&[file, found] : *items)
-            {
-              if(found) srcs.append(" select " + file.path().generic_string());
-            }
-          }
-
-          if(auto suites{filter.selected_suites()})
-          {
-            for(const auto&[name, found] : *suites)
-            {
-              if(found) srcs.append(" test " + name);
-            }
-          }
-
-          return srcs;
-        }()
-      };
+      const auto specified{to_selection_options(m_Filter)};
 
       for(std::size_t i{}; i < m_NumReps; ++i)
       {
@@ -776,6 +892,8 @@ namespace sequoia::testing
     }
     else
     {
+      if(m_Shard.partitioned()) select_shard();
+
       if(concurrent_execution()) sort_tests();
 
       if(m_InstabilityMode == instability_mode::sandbox)
@@ -826,42 +944,34 @@ namespace sequoia::testing
   {
     const timer t{};
 
-    stream() << running_tests_message(m_ConcurrencyMode);
+    stream() << running_tests_message(m_ConcurrencyMode, m_NumProcesses);
 
     std::optional<log_summary::duration> asyncDuration{};
-    if(concurrent_execution())
+    if(multi_process())
+    {
+      asyncDuration = run_shards();
+    }
+    else if(concurrent_execution())
     {
       auto first{std::ranges::find_if(m_Suites.begin_node_weights(), m_Suites.end_node_weights(), [](const auto& wt) -> bool { return wt.optTest != std::nullopt; })};
       auto next{std::ranges::find_if(first, m_Suites.end_node_weights(), [](const auto& wt) -> bool { return wt.optTest->parallelizable(); })};
 
-      auto executor{[id](auto& wt){ wt.summary = wt.optTest->execute(id); }};
+      auto execute{[id](auto& wt){ wt.summary = wt.optTest->execute(id); }};
 
       const timer asyncTimer{};
-      std::ranges::for_each(first, next, executor);
-
-      switch(m_ConcurrencyMode)
-      {
-        using enum concurrency_mode;
-      case dynamic:
-        accelerate(sequoia::execution::par, std::span{next, m_Suites.end_node_weights()}, executor);
-        break;
-      case fixed:
-        accelerate(thread_pool_policy{.num{m_PoolSize}}, std::span{next, m_Suites.end_node_weights()}, executor);
-        break;
-      default:
-        throw std::logic_error{"Unexpected concurrency_mode"};
-      }
+      std::ranges::for_each(first, next, execute);
+      m_Executor.for_each(std::ranges::subrange{next, m_Suites.end_node_weights()}, execute);
 
       asyncDuration = asyncTimer.time_elapsed();
     }
 
-    test_tracker tracker{proj_paths(), id, m_Filter ? is_filtered::yes : is_filtered::no};
+    test_tracker tracker{proj_paths(), id, (m_Filter || m_Shard.partitioned()) ? is_filtered::yes : is_filtered::no, m_ShardOutput, m_Executor};
 
     using namespace maths;
     auto nodeEarly{
-      [&s = m_Suites,&tracker,id,serial{!concurrent_execution()}](auto n) {
+      [&s = m_Suites,&tracker,id,executeHere{!concurrent_execution() && !multi_process()}](auto n) {
         tracker.increment_depth();
-        if(serial)
+        if(executeHere)
         {
           auto& wt{s.begin_node_weights()[n]};
           if(wt.optTest) { wt.summary = wt.optTest->execute(id); }
@@ -900,17 +1010,20 @@ namespace sequoia::testing
 
     traverse(depth_first, m_Suites, find_disconnected_t{}, nodeEarly, nodeLate, null_func_obj{});
 
+    if(m_ShardOutput.empty() && (m_InstabilityMode == instability_mode::none))
+      record_durations();
+
     if(m_OutputMode == output_mode::verbose)
     {
       indentation indent0{no_indent}, indent1{tab};
       auto printNode{
-        [&s=m_Suites,&indent0,&indent1,&stream=stream(),serial{!concurrent_execution()}](auto n) {
+        [&s=m_Suites,&indent0,&indent1,&stream=stream(),serial{!concurrent_execution()},staging{m_StagingDetail}](auto n) {
           if(n)
           {
             const auto& wt{s.cbegin_node_weights()[n]};
             if(wt.optTest)
             {
-              stream << summarize(wt.summary, "", summary_detail::failure_messages | summary_detail::timings, indent0, indent1);
+              stream << summarize(wt.summary, "", summary_detail::failure_messages | summary_detail::timings | staging, indent0, indent1);
             }
             else
             {
@@ -938,7 +1051,7 @@ namespace sequoia::testing
     {
       for(const auto& edge : m_Suites.cedges(0))
       {
-        const auto detail{!concurrent_execution() ? summary_detail::failure_messages | summary_detail::timings : summary_detail::failure_messages};
+        const auto detail{(!concurrent_execution() ? summary_detail::failure_messages | summary_detail::timings : summary_detail::failure_messages) | m_StagingDetail};
         auto targetNodeIter{std::ranges::next(m_Suites.cbegin_node_weights(), edge.target_node())};
         stream() << summarize(targetNodeIter->summary, ":", detail, no_indent, tab);
       }
@@ -947,7 +1060,120 @@ namespace sequoia::testing
     if(asyncDuration) m_Suites.begin_node_weights()->summary.execution_time(*asyncDuration);
 
     stream() << "\n-----------Grand Totals-----------\n";
-    stream() << summarize(m_Suites.cbegin_node_weights()->summary, "", t.time_elapsed(), summary_detail::absent_checks | summary_detail::timings, indentation{"\t"}, no_indent);
+    stream() << summarize(m_Suites.cbegin_node_weights()->summary, "", t.time_elapsed(), summary_detail::absent_checks | summary_detail::timings | m_StagingDetail, indentation{"\t"}, no_indent);
+  }
+
+  void test_runner::select_shard()
+  {
+    const auto history{read_test_durations(proj_paths().prune().durations())};
+    const auto fallback{
+      [&history]() -> log_summary::duration {
+        if(history.empty()) return log_summary::duration{1};
+
+        log_summary::duration total{};
+        for(const auto& entry : history) total += entry.second;
+        return total / static_cast<log_summary::duration::rep>(history.size());
+      }()
+    };
+
+    // Tests defined in the same source file share materials, and so must run in the same shard
+    std::map<std::string, log_summary::duration> sourceWeights{};
+    std::vector<std::string> nodeSources(m_Suites.order());
+    for(std::size_t n{1}; n < m_Suites.order(); ++n)
+    {
+      if(const auto& wt{m_Suites.cbegin_node_weights()[n]}; wt.optTest)
+      {
+        auto id{make_identity(*wt.optTest, proj_paths())};
+        const auto found{history.find(id)};
+        sourceWeights[id.source] += (found != history.end()) ? found->second : fallback;
+        nodeSources[n] = std::move(id.source);
+      }
+    }
+
+    const auto weights{sourceWeights | std::views::values | std::ranges::to<std::vector>()};
+    const auto shards{balance_shards(weights, m_Shard.count)};
+
+    std::set<std::string_view> selected{};
+    for(std::size_t i{}; const auto& source : sourceWeights | std::views::keys)
+    {
+      if(shards[i++] == m_Shard.index) selected.insert(source);
+    }
+
+    // Children are added after their parents, so working backwards leaves empty suites
+    // as leaves by the time they are visited, and never invalidates indices still to be visited.
+    for(auto n{m_Suites.order()}; n-- > 1;)
+    {
+      const auto& wt{m_Suites.cbegin_node_weights()[n]};
+      const bool prunable{wt.optTest ? !selected.contains(nodeSources[n])
+                                     : (m_Suites.cbegin_edges(n) == m_Suites.cend_edges(n))};
+      if(prunable) m_Suites.prune(n);
+    }
+
+    reset_tests();
+  }
+
+  [[nodiscard]]
+  log_summary::duration test_runner::run_shards()
+  {
+    if(proj_paths().executable().empty())
+      throw std::runtime_error{"Unable to run across multiple processes, as executable cannot be found"};
+
+    const timer t{};
+    const auto shardsDir{proj_paths().output().shards()};
+    fs::remove_all(shardsDir);
+    fs::create_directories(shardsDir);
+
+    const auto options{
+      to_selection_options(m_Filter).append(to_async_option(m_ConcurrencyMode, m_PoolSize)).append(to_staging_option(m_StagingMode))
+    };
+
+    {
+      std::vector<std::jthread> children{};
+      for(std::size_t i{}; i < m_NumProcesses; ++i)
+      {
+        const shard_spec spec{.index{i}, .count{m_NumProcesses}};
+        runtime::shell_command cmd{"",
+                                   proj_paths().executable().string().append(" --shard ").append(to_string(spec))
+                                                                     .append(" --shard-output ").append(shard_output(shardsDir, i).string())
+                                                                     .append(options),
+                                   shard_log(shardsDir, i)};
+
+        children.emplace_back([cmd{std::move(cmd)}](){ invoke(cmd); });
+      }
+    }
+
+    std::map<test_identity, log_summary> results{};
+    for(std::size_t i{}; i < m_NumProcesses; ++i)
+    {
+      for(auto& record : read_shard_records(shard_output(shardsDir, i)))
+      {
+        test_identity id{std::move(record.source), record.summary.name()};
+        results.insert_or_assign(std::move(id), std::move(record.summary));
+      }
+    }
+
+    std::ranges::for_each(m_Suites.begin_node_weights(), m_Suites.end_node_weights(), [&](suite_node& wt) {
+      if(wt.optTest)
+      {
+        if(auto found{results.find(make_identity(*wt.optTest, proj_paths()))}; found != results.end())
+          wt.summary = std::move(found->second);
+        else
+          wt.summary = unreported_summary(*wt.optTest, shardsDir);
+      }
+    });
+
+    return t.time_elapsed();
+  }
+
+  void test_runner::record_durations() const
+  {
+    test_duration_history durations{};
+    std::ranges::for_each(m_Suites.cbegin_node_weights(), m_Suites.cend_node_weights(), [&](const suite_node& wt) {
+      if(wt.optTest && !wt.summary.critical_failures())
+        durations.insert_or_assign(make_identity(*wt.optTest, proj_paths()), wt.summary.execution_time());
+    });
+
+    update_test_durations(proj_paths().prune().durations(), durations);
   }
 
   [[nodiscard]]
@@ -982,7 +1208,7 @@ namespace sequoia::testing
           [&,this](auto& wt){
             if(wt.optTest)
             {
-              wt.optTest->reset(proj_paths(), materialsPaths);
+              wt.optTest->reset(proj_paths(), materialsPaths, m_StagingMode, m_Executor);
             }
             else
             {
@@ -1032,7 +1258,7 @@ namespace sequoia::testing
   {
     if(m_PruneInfo.mode == prune_mode::passive) return prune_outcome::not_attempted;
 
-    if(auto maybeToRun{tests_to_run(proj_paths(), m_PruneInfo.include_cutoff)})
+    if(auto maybeToRun{tests_to_run(proj_paths(), m_PruneInfo.include_cutoff, m_Executor)})
     {
       for(const auto& src : maybeToRun.value())
       {
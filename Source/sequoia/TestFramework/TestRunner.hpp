@@ -12,7 +12,10 @@
 */
 
 #include "sequoia/TestFramework/DependencyAnalyzer.hpp"
+#include "sequoia/TestFramework/MaterialsStaging.hpp"
 #include "sequoia/TestFramework/PerformanceTestCore.hpp"
+#include "sequoia/TestFramework/Sharding.hpp"
+#include "sequoia/TestFramework/Summary.hpp"
 #include "sequoia/TestFramework/TestLogger.hpp"
 
 #include "sequoia/Core/Logic/Bitmask.hpp"
@@ -53,7 +56,28 @@ NAMESPACE_SEQUOIA_AS_BITMASK
 
 namespace sequoia::testing
 {
-  individual_materials_paths set_materials(const std::filesystem::path& sourceFile, const project_paths& projPaths, std::vector<std::filesystem::path>& materialsPaths);
+  struct staged_materials
+  {
+    individual_materials_paths paths{};
+    staging_statistics statistics{};
+  };
+
+  /*! \brief Stages the materials for the test defined in `sourceFile`, unless already present in `materialsPaths`. */
+  [[nodiscard]]
+  staged_materials stage_materials(const std::filesystem::path& sourceFile,
+                                   const project_paths& projPaths,
+                                   std::vector<std::filesystem::path>& materialsPaths,
+                                   staging_mode mode,
+                                   const task_executor& executor = {});
+
+  /*! \brief Locates, without staging, the materials for the test defined in `sourceFile`. */
+  [[nodiscard]]
+  individual_materials_paths locate_materials(const std::filesystem::path& sourceFile, const project_paths& projPaths);
+
+  individual_materials_paths set_materials(const std::filesystem::path& sourceFile,
+                                           const project_paths& projPaths,
+                                           std::vector<std::filesystem::path>& materialsPaths,
+                                           staging_mode mode = staging_mode::clone);
 
   class test_vessel
   {
@@ -112,13 +136,17 @@ namespace sequoia::testing
     [[nodiscard]]
     log_summary execute(std::optional<std::size_t> index)
     {
-      return m_pTest->execute(index);
+      auto summary{m_pTest->execute(index)};
+      summary.materials_staging(m_Staging);
+      return summary;
     }
 
-    void reset(const project_paths& projPaths, std::vector<std::filesystem::path>& materialsPaths)
+    void reset(const project_paths& projPaths, std::vector<std::filesystem::path>& materialsPaths, staging_mode mode, const task_executor& executor)
     {
-      m_pTest->reset(projPaths, materialsPaths);
+      m_Staging = m_pTest->reset(projPaths, materialsPaths, mode, executor);
     }
+
+    void materials_staging(const staging_statistics& stats) noexcept { m_Staging = stats; }
   private:
     static void versioned_write(const std::filesystem::path& file, const failure_output& output);
     static void versioned_write(const std::filesystem::path& file, std::string_view text);
@@ -134,7 +162,10 @@ namespace sequoia::testing
       virtual std::filesystem::path predictive_materials() const          = 0;
 
       virtual log_summary execute(std::optional<std::size_t> index) = 0;
-      virtual void reset(const project_paths& projPaths, std::vector<std::filesystem::path>& materialsPaths) = 0;
+      virtual staging_statistics reset(const project_paths& projPaths,
+                                       std::vector<std::filesystem::path>& materialsPaths,
+                                       staging_mode mode,
+                                       const task_executor& executor) = 0;
     };
 
     template<concrete_test Test>
@@ -197,10 +228,13 @@ namespace sequoia::testing
         return write_versioned_output(t);
       }
 
-      void reset(const project_paths& projPaths, std::vector<std::filesystem::path>& materialsPaths) final
+      staging_statistics reset(const project_paths& projPaths,
+                               std::vector<std::filesystem::path>& materialsPaths,
+                               staging_mode mode,
+                               const task_executor& executor) final
       {
         m_Test.reset_results();
-        set_materials(m_Test.source_file(), projPaths, materialsPaths);
+        return stage_materials(m_Test.source_file(), projPaths, materialsPaths, mode, executor).statistics;
       }
     private:
       log_summary write_versioned_output(const timer& t) const
@@ -223,6 +257,7 @@ namespace sequoia::testing
 
     std::unique_ptr<soul> m_pTest{};
     parallelizable_candidate m_Parallelizable{parallelizable_candidate::yes};
+    staging_statistics m_Staging{};
   };
 
   template<concrete_test T>
@@ -350,10 +385,20 @@ namespace sequoia::testing
     recovery_mode    m_RecoveryMode{recovery_mode::none};
     concurrency_mode m_ConcurrencyMode{concurrency_mode::dynamic};
     instability_mode m_InstabilityMode{instability_mode::none};
+    staging_mode     m_StagingMode{staging_mode::clone};
+    thread_affinity  m_Affinity{thread_affinity::none};
+    summary_detail   m_StagingDetail{summary_detail::none};
+    shard_spec       m_Shard{};
 
     std::size_t m_NumReps{1},
                 m_RunnerID{},
-                m_PoolSize{8};
+                m_PoolSize{8},
+                m_NumProcesses{1};
+
+    std::filesystem::path m_ShardOutput{};
+
+    /// Shared by every phase of the run, from dependency analysis through to updating materials
+    task_executor m_Executor{};
 
     void process_args(int argc, char** argv);
 
@@ -364,6 +409,20 @@ namespace sequoia::testing
     [[nodiscard]]
     bool concurrent_execution() const noexcept { return m_ConcurrencyMode != concurrency_mode::serial; }
 
+    [[nodiscard]]
+    bool multi_process() const noexcept { return m_NumProcesses > 1; }
+
+    /// Materials are staged only once it is known which tests will run in this process
+    [[nodiscard]]
+    bool deferred_staging() const noexcept { return m_Shard.partitioned() || multi_process(); }
+
+    void select_shard();
+
+    [[nodiscard]]
+    log_summary::duration run_shards();
+
+    void record_durations() const;
+
     void sort_tests();
 
     void reset_tests();
@@ -402,16 +461,20 @@ namespace sequoia::testing
                    overloaded{
                      [] <class... Ts> (const suite<Ts...>& s) -> suite_node { return {.summary{log_summary{s.name()}}}; },
                      [this, &suiteName, &materialsPaths]<concrete_test T>(T&& test) -> suite_node {
+                       auto staged{deferred_staging() ? staged_materials{.paths{locate_materials(test.source_file(), proj_paths())}}
+                                                      : stage_materials(test.source_file(), proj_paths(), materialsPaths, m_StagingMode, m_Executor)};
                        test = T{test.name(),
                                 suiteName,
                                 test.source_file(),
                                 proj_paths(),
-                                set_materials(test.source_file(), proj_paths(), materialsPaths),
+                                std::move(staged.paths),
                                 make_active_recovery_paths(m_RecoveryMode, proj_paths()),
                                 get_output_discriminator(test),
                                 get_reduction_discriminator(test)};
-                   
-                       return {.summary{log_summary{test.name()}}, .optTest{std::move(test)}};
+
+                       suite_node node{.summary{log_summary{test.name()}}, .optTest{std::move(test)}};
+                       node.optTest->materials_staging(staged.statistics);
+                       return node;
                      }
                    },
                    m_Suites,
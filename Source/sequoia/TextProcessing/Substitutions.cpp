@@ -11,6 +11,10 @@
 
 #include "sequoia/TextProcessing/Substitutions.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
 namespace sequoia
 {
   std::string& to_camel_case(std::string& text, std::string_view separator)
@@ -119,11 +123,22 @@ namespace sequoia
 
   std::string& replace_all(std::string& text, std::string_view from, std::string_view to)
   {
-    std::string::size_type pos{};
+    if(from.empty()) return text;
+
+    std::string::size_type pos{}, copied{};
+    std::string result{};
     while((pos = text.find(from, pos)) != std::string::npos)
     {
-      text.replace(pos, from.length(), to);
-      pos += to.length();
+      if(result.empty()) result.reserve(text.size());
+      result.append(text, copied, pos - copied).append(to);
+      pos += from.length();
+      copied = pos;
+    }
+
+    if(copied)
+    {
+      result.append(text, copied);
+      text = std::move(result);
     }
 
     return text;
@@ -172,4 +187,209 @@ namespace sequoia
     std::string str{text};
     return replace_all(str, anyOfLeft, from, anyOfRight, to);
   }
+
+  //=========================================== multi_replacer ===========================================//
+
+  multi_replacer::multi_replacer(std::span<const replacement> replacements)
+    : m_Replacements(replacements.begin(), replacements.end())
+  {
+    build();
+  }
+
+  multi_replacer::multi_replacer(std::initializer_list<replacement> replacements)
+    : m_Replacements(replacements)
+  {
+    build();
+  }
+
+  void multi_replacer::build()
+  {
+    if(std::ranges::any_of(m_Replacements, [](const replacement& r) { return r.from.empty(); }))
+      throw std::logic_error{"multi_replacer: patterns must not be empty"};
+
+    for(const auto& r : m_Replacements)
+      m_MaxLength = std::ranges::max(m_MaxLength, r.from.size());
+
+    for(const auto& r : m_Replacements)
+      m_Initials[static_cast<unsigned char>(r.from.front())] = true;
+
+    if(std::ranges::count(m_Initials, true) == 1) m_SoleInitial = m_Replacements.front().from.front();
+
+    // Bytes which appear in no pattern share class 0, keeping the transition table small
+    for(const auto& r : m_Replacements)
+    {
+      for(const auto c : r.from)
+      {
+        auto& cls{m_Classes[static_cast<unsigned char>(c)]};
+        if(!cls) cls = static_cast<std::uint16_t>(m_NumClasses++);
+      }
+    }
+
+    // Build the trie, with absent transitions temporarily marked as npos
+    m_Nodes.emplace_back();
+    m_Transitions.assign(m_NumClasses, npos);
+    for(std::uint32_t i{}; i < m_Replacements.size(); ++i)
+    {
+      std::uint32_t state{};
+      for(const auto c : m_Replacements[i].from)
+      {
+        const auto index{state * m_NumClasses + m_Classes[static_cast<unsigned char>(c)]};
+        if(m_Transitions[index] == npos)
+        {
+          m_Transitions[index] = static_cast<std::uint32_t>(m_Nodes.size());
+          m_Nodes.emplace_back();
+          m_Transitions.resize(m_Transitions.size() + m_NumClasses, npos);
+        }
+
+        state = m_Transitions[index];
+      }
+
+      if(m_Nodes[state].output == npos) m_Nodes[state].output = i;
+    }
+
+    // Breadth-first construction of failure and dictionary links, completing the transitions into a DFA
+    std::vector<std::uint32_t> queue{};
+    queue.reserve(m_Nodes.size());
+    for(std::size_t c{}; c < m_NumClasses; ++c)
+    {
+      auto& t{m_Transitions[c]};
+      if(t == npos)
+      {
+        t = 0;
+      }
+      else
+      {
+        m_Nodes[t].depth = 1;
+        queue.push_back(t);
+      }
+    }
+
+    for(std::size_t q{}; q < queue.size(); ++q)
+    {
+      const auto u{queue[q]};
+      const auto fail{m_Nodes[u].fail};
+      for(std::size_t c{}; c < m_NumClasses; ++c)
+      {
+        auto& t{m_Transitions[u * m_NumClasses + c]};
+        const auto fallback{m_Transitions[fail * m_NumClasses + c]};
+        if(t == npos)
+        {
+          t = fallback;
+        }
+        else
+        {
+          auto& v{m_Nodes[t]};
+          v.fail       = fallback;
+          v.depth      = m_Nodes[u].depth + 1;
+          v.dictionary = (m_Nodes[fallback].output != npos) ? fallback : m_Nodes[fallback].dictionary;
+          queue.push_back(t);
+        }
+      }
+    }
+  }
+
+  [[nodiscard]]
+  std::string multi_replacer::apply(std::string_view text) const
+  {
+    if(m_Replacements.empty()) return std::string{text};
+
+    /* The longest pattern starting at each position in a sliding window. Once the automaton
+       is in a state of depth d, having scanned position i, no match yet to be reported can
+       start before i + 1 - d. All earlier positions are therefore final and are emitted, left
+       to right, skipping any match which overlaps one already emitted. */
+    const auto mask{std::bit_ceil(m_MaxLength + 1) - 1};
+    std::vector<std::uint32_t> window(mask + 1, npos);
+    std::size_t pending{}, finalized{}, copied{};
+
+    std::string result{};
+    result.reserve(text.size());
+
+    auto finalize_until{
+      [&](const std::size_t limit) {
+        for(; pending && (finalized < limit); ++finalized)
+        {
+          if(auto& r{window[finalized & mask]}; r != npos)
+          {
+            if(finalized >= copied)
+            {
+              result.append(text.substr(copied, finalized - copied)).append(m_Replacements[r].to);
+              copied = finalized + m_Replacements[r].from.size();
+            }
+
+            r = npos;
+            --pending;
+          }
+        }
+
+        finalized = limit;
+      }
+    };
+
+    std::uint32_t state{};
+    for(std::size_t i{}; i < text.size(); ++i)
+    {
+      // Outside of a partial match, skip directly to the next byte which may begin a pattern
+      if(!state && !pending)
+      {
+        if(m_SoleInitial)
+        {
+          i = text.find(*m_SoleInitial, i);
+          if(i == std::string_view::npos) break;
+        }
+        else
+        {
+          while((i < text.size()) && !m_Initials[static_cast<unsigned char>(text[i])]) ++i;
+          if(i == text.size()) break;
+        }
+
+        finalized = i;
+      }
+
+      state = next(state, text[i]);
+      const auto& current{m_Nodes[state]};
+      for(auto n{current.output != npos ? state : current.dictionary}; n != npos; n = m_Nodes[n].dictionary)
+      {
+        const auto r{m_Nodes[n].output};
+        auto& l{window[(i + 1 - m_Replacements[r].from.size()) & mask]};
+        if(l == npos)
+        {
+          l = r;
+          ++pending;
+        }
+        else if(m_Replacements[l].from.size() < m_Replacements[r].from.size())
+        {
+          l = r;
+        }
+      }
+
+      finalize_until(i + 1 - current.depth);
+    }
+
+    finalize_until(text.size());
+
+    return result.append(text.substr(copied));
+  }
+
+  std::string& replace_all(std::string& text, const multi_replacer& replacer)
+  {
+    text = replacer.apply(text);
+    return text;
+  }
+
+  [[nodiscard]]
+  std::string replace_all(std::string_view text, const multi_replacer& replacer)
+  {
+    return replacer.apply(text);
+  }
+
+  std::string& replace_all(std::string& text, std::span<const replacement> replacements)
+  {
+    return replace_all(text, multi_replacer{replacements});
+  }
+
+  [[nodiscard]]
+  std::string replace_all(std::string_view text, std::span<const replacement> replacements)
+  {
+    return multi_replacer{replacements}.apply(text);
+  }
 }
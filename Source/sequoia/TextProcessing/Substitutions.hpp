@@ -13,7 +13,13 @@
 
 #include "sequoia/Core/Meta/Concepts.hpp"
 
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace sequoia
 {
@@ -97,6 +103,65 @@ namespace sequoia
     std::string from, to;
   };
 
+  /*! \brief Replaces occurrences of any of a set of patterns in a single pass.
+
+      The patterns are compiled into an Aho-Corasick automaton, so that the text is scanned
+      once, irrespective of the number of patterns, and the result is written to a fresh
+      buffer. Matches are non-overlapping: scanning from the left, the longest pattern
+      starting at a given position is replaced and scanning resumes after it. Should the
+      same pattern appear more than once, the first replacement is used. Unlike the variadic
+      `replace_all`, which applies each replacement to the output of the last, replacement
+      text is never rescanned.
+   */
+  class multi_replacer
+  {
+  public:
+    multi_replacer() = default;
+
+    explicit multi_replacer(std::span<const replacement> replacements);
+
+    multi_replacer(std::initializer_list<replacement> replacements);
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return m_Replacements.size(); }
+
+    [[nodiscard]]
+    std::string apply(std::string_view text) const;
+  private:
+    constexpr static std::uint32_t npos{static_cast<std::uint32_t>(-1)};
+
+    struct node
+    {
+      std::uint32_t fail{}, output{npos}, dictionary{npos}, depth{};
+    };
+
+    std::vector<replacement> m_Replacements{};
+    std::array<std::uint16_t, 256> m_Classes{};
+    std::size_t m_NumClasses{1}, m_MaxLength{};
+    std::array<bool, 256> m_Initials{};
+    std::optional<char> m_SoleInitial{};
+    std::vector<node> m_Nodes{};
+    std::vector<std::uint32_t> m_Transitions{};
+
+    [[nodiscard]]
+    std::uint32_t next(std::uint32_t state, char c) const noexcept
+    {
+      return m_Transitions[state * m_NumClasses + m_Classes[static_cast<unsigned char>(c)]];
+    }
+
+    void build();
+  };
+
+  std::string& replace_all(std::string& text, const multi_replacer& replacer);
+
+  [[nodiscard]]
+  std::string replace_all(std::string_view text, const multi_replacer& replacer);
+
+  std::string& replace_all(std::string& text, std::span<const replacement> replacements);
+
+  [[nodiscard]]
+  std::string replace_all(std::string_view text, std::span<const replacement> replacements);
+
   template<class... Replacement>
     requires (std::is_same_v<Replacement, replacement> && ...)
   std::string& replace_all(std::string& text, const Replacement&... rs)
@@ -120,11 +185,15 @@ namespace sequoia
   [[nodiscard]]
   std::string replace_all(std::string_view text, std::string_view anyOfLeft, std::string_view from, std::string_view anyOfRight, std::string_view to);
 
+  /// The result is built in a fresh buffer, rather than by repeatedly shifting the tail of the text
   template<invocable_r<bool, char> LeftPred, invocable_r<bool, char> RightPred>
   std::string& replace_all(std::string& text, LeftPred lPred, std::string_view from, RightPred rPred, std::string_view to)
   {
+    if(from.empty()) return text;
+
     constexpr auto npos{std::string::npos};
-    std::string::size_type pos{};
+    std::string::size_type pos{}, copied{};
+    std::string result{};
     while((pos = text.find(from, pos)) != npos)
     {
       if(    (((pos > 0) && lPred(text[pos - 1])) || ((pos == 0) && lPred('\0')))
@@ -132,13 +201,18 @@ namespace sequoia
               || ((pos + from.length() == text.length()) && rPred('\0')))
         )
       {
-        text.replace(pos, from.length(), to);
-        pos += (to.length() + 1);
-      }
-      else
-      {
-        pos += (from.length() + 1) ;
+        if(result.empty()) result.reserve(text.size());
+        result.append(text, copied, pos - copied).append(to);
+        copied = pos + from.length();
       }
+
+      pos += (from.length() + 1);
+    }
+
+    if(copied)
+    {
+      result.append(text, copied);
+      text = std::move(result);
     }
 
     return text;
@@ -41,9 +41,13 @@ int main(int argc, char** argv)
       commands_free_test{"Commands Free Test"},
       failure_info_test{"failure_info Unit Test"},
       failure_info_false_negative_test{"failure_info False Negative Test"},
+      file_editors_free_test{"File Editors Free Test"},
       file_system_utilities_free_test{"File System Free Test"},
       output_free_test{"Output Free Test"},
       dependency_analyzer_free_test{"Dependency Analyzer Free Test"},
+      materials_staging_free_test{"Materials Staging Free Test"},
+      sharding_free_test{"Sharding Free Test"},
+      task_executor_free_test{"Task Executor Free Test"},
       materials_updater_free_test{"Free Test"}
     );
 
@@ -137,7 +141,8 @@ int main(int argc, char** argv)
       "Text Processing",
       indent_free_test{"Indent Free Test"},
       patterns_free_test{"Patterns Free Test"},
-      substitutions_free_test{"Substitutions Free Test"}
+      substitutions_free_test{"Substitutions Free Test"},
+      substitutions_performance_test{"Substitutions Performance Test"}
     );
 
     runner.add_test_suite(
@@ -209,7 +214,15 @@ int main(int argc, char** argv)
     runner.add_test_suite(
       "Concurrency Models",
       threading_models_test{"Unit Test"},
-      threading_models_performance_test{"Performance Test"}
+      threading_models_performance_test{"Performance Test"},
+      futures_free_test{"Futures Free Test"},
+      topology_free_test{"Topology Free Test"}
+    );
+
+    runner.add_test_suite(
+      "Memory Resources",
+      memory_resources_free_test{"Free Test"},
+      memory_resources_performance_test{"Performance Test"}
     );
 
     runner.add_test_suite(
@@ -291,6 +304,8 @@ int main(int argc, char** argv)
           dynamic_undirected_graph_unsortable_weight_test{"Undirected Graph Unsortable Weight Test"},
           dynamic_undirected_graph_shared_fundamental_weight_test{"Undirected Graph Shared Fundamental Weight Test"},
           dynamic_undirected_graph_shared_fundamental_weight_contiguous_test{"Undirected Graph Shared Fundamental Weight Contiguous Test"},
+          dynamic_undirected_graph_counted_fundamental_weight_test{"Undirected Graph Counted Fundamental Weight Test"},
+          dynamic_undirected_graph_counted_fundamental_weight_contiguous_test{"Undirected Graph Counted Fundamental Weight Contiguous Test"},
           dynamic_undirected_graph_shared_unsortable_weight_test{"Undirected Graph Shared Unsortable Weight Test"},
           dynamic_undirected_graph_meta_data_test{"Undirected Graph Meta Data Test"}
         },
@@ -303,7 +318,8 @@ int main(int argc, char** argv)
           dynamic_undirected_embedded_graph_shared_fundamental_weight_test{"Undirected Embedded Graph Shared Fundamental Weight Test"},
           dynamic_undirected_embedded_graph_shared_fundamental_weight_contiguous_test{"Undirected Embedded Graph Shared Fundamental Weight Contiguous Test"},
           dynamic_undirected_embedded_graph_meta_data_test{"Undirected Graph Meta Data Test"}
-        }
+        },
+        dynamic_graph_edge_lookup_free_test{"Edge Lookup Free Test"}
       },
       suite{
         "Static",
@@ -342,7 +358,10 @@ int main(int argc, char** argv)
       test_graph_traversals{"Traversals"},
       test_static_graph_traversals{"Static Graph Traversals"},
       test_graph_update{"Updates"},
-      test_subgraph{"Subgraph"}
+      test_subgraph{"Subgraph"},
+      task_graph_free_test{"Task Graph Free Test"},
+      graph_algorithms_free_test{"Graph Algorithms Free Test"},
+      graph_algorithms_performance_test{"Graph Algorithms Performance Test"}
     );
 
     runner.add_test_suite(
@@ -415,7 +434,9 @@ int main(int argc, char** argv)
       convex_physical_value_test{"Convex Physical Value Test"},
       vector_physical_value_test{"Vector Physical Value Test"},
       mixed_physical_value_test{"Mixed Physical Value Test"},
-      integral_physical_value_test{"Integral Physical Value Test"}
+      integral_physical_value_test{"Integral Physical Value Test"},
+      physical_value_array_test{"Physical Value Array Test"},
+      physical_value_expression_test{"Physical Value Expression Test"}
     );
 
     runner.add_test_suite(
@@ -8,6 +8,8 @@
 #include "Algorithms/AlgorithmsTest.hpp"
 #include "Core/Concurrency/ConcurrencyModelsPerformanceTest.hpp"
 #include "Core/Concurrency/ConcurrencyModelsTest.hpp"
+#include "Core/Concurrency/FuturesFreeTest.hpp"
+#include "Core/Concurrency/TopologyFreeTest.hpp"
 #include "Core/ContainerUtilities/ArrayUtilitiesTest.hpp"
 #include "Core/ContainerUtilities/IteratorTest.hpp"
 #include "Core/DataStructures/BucketedSequenceAllocationTest.hpp"
@@ -28,6 +30,8 @@
 #include "Core/DataStructures/StaticStackTest.hpp"
 #include "Core/DataStructures/StaticStackTestingDiagnostics.hpp"
 #include "Core/Logic/BitmaskFreeTest.hpp"
+#include "Core/Memory/MemoryResourcesFreeTest.hpp"
+#include "Core/Memory/MemoryResourcesPerformanceTest.hpp"
 #include "Core/Meta/ConceptsTest.hpp"
 #include "Core/Meta/SequencesFreeTest.hpp"
 #include "Core/Meta/TypeAlgorithmsFreeTest.hpp"
@@ -50,7 +54,10 @@
 #include "Maths/Graph/Algorithms/DynamicGraphTraversalsTest.hpp"
 #include "Maths/Graph/Algorithms/DynamicGraphUpdateTest.hpp"
 #include "Maths/Graph/Algorithms/DynamicSubgraphTest.hpp"
+#include "Maths/Graph/Algorithms/GraphAlgorithmsFreeTest.hpp"
+#include "Maths/Graph/Algorithms/GraphAlgorithmsPerformanceTest.hpp"
 #include "Maths/Graph/Algorithms/StaticGraphTraversalsTest.hpp"
+#include "Maths/Graph/Algorithms/TaskGraphFreeTest.hpp"
 #include "Maths/Graph/Components/Edges/EdgeTest.hpp"
 #include "Maths/Graph/Components/Edges/EdgeTestingDiagnostics.hpp"
 #include "Maths/Graph/Components/Meta/GraphMetaTest.hpp"
@@ -66,6 +73,9 @@
 #include "Maths/Graph/Dynamic/Directed/DynamicDirectedGraphFundamentalWeightTest.hpp"
 #include "Maths/Graph/Dynamic/Directed/DynamicDirectedGraphUnweightedContiguousTest.hpp"
 #include "Maths/Graph/Dynamic/Directed/DynamicDirectedGraphUnweightedTest.hpp"
+#include "Maths/Graph/Dynamic/DynamicGraphEdgeLookupFreeTest.hpp"
+#include "Maths/Graph/Dynamic/Undirected/DynamicUndirectedGraphCountedFundamentalWeightContiguousTest.hpp"
+#include "Maths/Graph/Dynamic/Undirected/DynamicUndirectedGraphCountedFundamentalWeightTest.hpp"
 #include "Maths/Graph/Dynamic/Undirected/DynamicUndirectedGraphFundamentalWeightContiguousTest.hpp"
 #include "Maths/Graph/Dynamic/Undirected/DynamicUndirectedGraphFundamentalWeightTest.hpp"
 #include "Maths/Graph/Dynamic/Undirected/DynamicUndirectedGraphMetaDataTest.hpp"
@@ -105,6 +115,8 @@
 #include "Physics/ConvexPhysicalValueTest.hpp"
 #include "Physics/IntegralPhysicalValueTest.hpp"
 #include "Physics/MixedPhysicalValueTest.hpp"
+#include "Physics/PhysicalValueArrayTest.hpp"
+#include "Physics/PhysicalValueExpressionTest.hpp"
 #include "Physics/PhysicalValueMetaFreeTest.hpp"
 #include "Physics/PhysicalValueTestingDiagnostics.hpp"
 #include "Physics/UnsafeAbsolutePhysicalValueTest.hpp"
@@ -137,10 +149,12 @@
 #include "TestFramework/ExceptionsFreeDiagnostics.hpp"
 #include "TestFramework/FailureInfoTest.hpp"
 #include "TestFramework/FailureInfoTestingDiagnostics.hpp"
+#include "TestFramework/FileEditorsFreeTest.hpp"
 #include "TestFramework/FileSystemUtilitiesFreeTest.hpp"
 #include "TestFramework/FreeCheckersMetaFreeTest.hpp"
 #include "TestFramework/FunctionFreeDiagnostics.hpp"
 #include "TestFramework/IndividualTestPathsFreeTest.hpp"
+#include "TestFramework/MaterialsStagingFreeTest.hpp"
 #include "TestFramework/MaterialsUpdaterFreeTest.hpp"
 #include "TestFramework/MoveOnlyStateTransitionDiagnostics.hpp"
 #include "TestFramework/MoveOnlyTestDiagnostics.hpp"
@@ -152,9 +166,11 @@
 #include "TestFramework/RegularStateTransitionDiagnostics.hpp"
 #include "TestFramework/RegularTestDiagnostics.hpp"
 #include "TestFramework/RelationalTestDiagnostics.hpp"
+#include "TestFramework/ShardingFreeTest.hpp"
 #include "TestFramework/SmartPointerFreeDiagnostics.hpp"
 #include "TestFramework/StringFreeDiagnostics.hpp"
 #include "TestFramework/SumTypesFreeDiagnostics.hpp"
+#include "TestFramework/TaskExecutorFreeTest.hpp"
 #include "TestFramework/TestRunnerDiagnostics.hpp"
 #include "TestFramework/TestRunnerEndToEndFreeTest.hpp"
 #include "TestFramework/TestRunnerPerformanceTest.hpp"
@@ -164,4 +180,5 @@
 #include "TextProcessing/IndentFreeTest.hpp"
 #include "TextProcessing/PatternsFreeTest.hpp"
 #include "TextProcessing/SubstitutionsFreeTest.hpp"
+#include "TextProcessing/SubstitutionsPerformanceTest.hpp"
 #include "sequoia/TestFramework/TestRunner.hpp"
@@ -10,6 +10,9 @@
 #include "ConcurrencyModelsPerformanceTest.hpp"
 #include "sequoia/Core/Concurrency/ConcurrencyModels.hpp"
 
+#include <numeric>
+#include <thread>
+
 namespace sequoia::testing
 {
   using namespace concurrency;
@@ -113,6 +116,29 @@ namespace sequoia::testing
       std::size_t m_NumTasks{};
       Task m_Task;
     };
+
+    /// Each of the producers concurrently pushes trivial tasks to a single pool
+    template<class ThreadModel>
+    void contended_push(const std::size_t numProducers, const std::size_t tasksPerProducer, const std::size_t numThreads)
+    {
+      ThreadModel model{numThreads};
+      std::vector<std::thread> producers{};
+      producers.reserve(numProducers);
+
+      for(std::size_t p{}; p < numProducers; ++p)
+      {
+        producers.emplace_back([&model, tasksPerProducer]() {
+          std::vector<std::future<int>> futures{};
+          futures.reserve(tasksPerProducer);
+          for(std::size_t i{}; i < tasksPerProducer; ++i)
+            futures.emplace_back(model.push([](){ return 42; }));
+
+          for(auto& f : futures) f.get();
+        });
+      }
+
+      for(auto& t : producers) t.join();
+    }
   }
 
   [[nodiscard]]
@@ -125,6 +151,8 @@ namespace sequoia::testing
   {
     test_waiting_task(std::chrono::milliseconds{15});
     test_waiting_task_return(std::chrono::milliseconds{15});
+    test_contended_push();
+    test_worker_placement();
   }
 
   void threading_models_performance_test::test_waiting_task(const std::chrono::milliseconds millisecs)
@@ -159,10 +187,13 @@ namespace sequoia::testing
 
       auto threadPoolMonoFn{[millisecs]() { waiting_task<wait, thread_pool<void, false>>{4u, wait{millisecs}, 4u}(); }};
 
+      auto threadPoolBoundedFn{[millisecs]() { waiting_task<wait, thread_pool<void, false, bounded_task_queue<void>>>{4u, wait{millisecs}, 4u}(); }};
+
       auto nullThreadFn{[millisecs]() { waiting_task<wait, serial<void>>{4u, wait{millisecs}}(); }};
 
       check_relative_performance("Four Waiting tasks; pool_4/null", threadPoolFn, nullThreadFn, 3.7, 4.1);
       check_relative_performance("Four Waiting tasks; pool_4M/null", threadPoolMonoFn, nullThreadFn, 3.7, 4.1);
+      check_relative_performance("Four Waiting tasks; pool_4B/null", threadPoolBoundedFn, nullThreadFn, 3.7, 4.1);
     }
   }
 
@@ -185,4 +216,77 @@ namespace sequoia::testing
       check_relative_performance("Two Waiting tasks; async/null", asyncFn, nullThreadFn, 1.9, 2.1);
     }
   }
+
+  void threading_models_performance_test::test_contended_push()
+  {
+    using mutex_pool     = thread_pool<int, false>;
+    using lock_free_pool = thread_pool<int, false, bounded_task_queue<int>>;
+
+    constexpr std::size_t tasksPerProducer{1000}, numThreads{4};
+
+    // Any speed-up under contention depends on the number of cores, which cannot be assumed, and
+    // with few producers the two queues perform similarly; the timings are therefore only reported
+    for(const std::size_t numProducers : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+      report_relative_performance(
+        std::format("Contended push; {} producers; lock_free/mutex", numProducers),
+        [numProducers](){ contended_push<lock_free_pool>(numProducers, tasksPerProducer, numThreads); },
+        [numProducers](){ contended_push<mutex_pool>(numProducers, tasksPerProducer, numThreads); }
+      );
+    }
+  }
+
+  void threading_models_performance_test::test_worker_placement()
+  {
+    // The benefit of local placement and stealing may only be observed on a machine with more than one node
+    const auto topology{detect_cpu_topology()};
+    if(topology.nodes.size() < 2) return;
+
+    const auto numThreads{topology.num_cpus()}, numTasks{8 * numThreads};
+    const auto layout{make_worker_layout(topology, numThreads)};
+
+    // The buffers are allocated up front, each on the node of the worker to whose pipeline its task is pushed.
+    // Only workers confined to their nodes are then guaranteed to stream local memory.
+    std::vector<std::vector<double>> buffers(numTasks);
+    for(std::size_t n{}; n < topology.nodes.size(); ++n)
+    {
+      std::thread{
+        [&, n]() {
+          pin_current_thread(topology.nodes[n].cpus);
+          for(std::size_t i{}; i < numTasks; ++i)
+          {
+            if(layout.workers[i % numThreads].node == n) buffers[i].assign(1 << 20, 1.0);
+          }
+        }
+      }.join();
+    }
+
+    auto stream{
+      [&buffers](thread_pool<double>& pool) {
+        std::vector<std::future<double>> futures{};
+        futures.reserve(buffers.size());
+        for(const auto& buffer : buffers)
+        {
+          futures.emplace_back(pool.push([&buffer]() {
+              double sum{};
+              for(int i{}; i < 8; ++i) sum += std::accumulate(buffer.begin(), buffer.end(), 0.0);
+
+              return sum;
+            }));
+        }
+
+        double total{};
+        for(auto& f : futures) total += f.get();
+
+        return total;
+      }
+    };
+
+    // The speed-up depends on the relative cost of remote memory access, so is only reported
+    report_relative_performance(
+      "Memory-bound tasks; pool_numa/pool",
+      [&](){ thread_pool<double> pool{numThreads, worker_placement::numa_node, topology}; return stream(pool); },
+      [&](){ thread_pool<double> pool{numThreads}; return stream(pool); }
+    );
+  }
 }
@@ -26,6 +26,8 @@ namespace sequoia::testing
 
     void test_waiting_task(const std::chrono::milliseconds millisecs);
     void test_waiting_task_return(const std::chrono::milliseconds millisecs);
+    void test_contended_push();
+    void test_worker_placement();
   };
 
   class wait
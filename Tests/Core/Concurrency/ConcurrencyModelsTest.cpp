@@ -10,10 +10,18 @@
 #include "ConcurrencyModelsTest.hpp"
 #include "sequoia/Core/Concurrency/ConcurrencyModels.hpp"
 
+#include <sstream>
+
 namespace sequoia::testing
 {
   using namespace concurrency;
 
+  namespace
+  {
+    template<std::size_t Capacity>
+    concept bounded_capacity = requires { typename bounded_task_queue<int, Capacity>; };
+  }
+
   [[nodiscard]]
   std::filesystem::path threading_models_test::source_file() const
   {
@@ -23,19 +31,37 @@ namespace sequoia::testing
   void threading_models_test::run_tests()
   {
     test_task_queue();
+    test_bounded_task_queue();
 
     test_exceptions<thread_pool<void>>("pool_2M", 2u);
     test_exceptions<thread_pool<void, false>>("pool_2", 2u);
+    test_exceptions<thread_pool<void, false, bounded_task_queue<void>>>("pool_2B", 2u);
     test_exceptions<asynchronous<void>>("async");
 
     test_exceptions<thread_pool<int>>("pool_2M", 2u);
     test_exceptions<thread_pool<int, false>>("pool_2", 2u);
+    test_exceptions<thread_pool<int, false, bounded_task_queue<int>>>("pool_2B", 2u);
     test_exceptions<asynchronous<int>>("async");
 
     test_execution<thread_pool<int>>("pool_2M", 2u);
     test_execution<thread_pool<int, false>>("pool_2", 2u);
+    test_execution<thread_pool<int, false, bounded_task_queue<int>>>("pool_2B", 2u);
+    test_execution<thread_pool<int, true, bounded_task_queue<int>>>("pool_2MB", 2u);
     test_execution<asynchronous<int>>("async");
 
+    test_bounded_pool_backpressure();
+
+    test_priority_task_queue();
+    test_prioritised_pool();
+
+    test_cancellation<thread_pool<int, false>>("pool_1", 1u);
+    test_cancellation<thread_pool<int>>("pool_1M", 1u);
+    test_cancellation<thread_pool<int, false, bounded_task_queue<int>>>("pool_1B", 1u);
+    test_cancellation<thread_pool<int, false, priority_task_queue<int>>>("pool_1P", 1u);
+
+    test_metrics<thread_pool<int, false, task_queue<int>, pool_metrics<1, true>>>("pool_2", 2u);
+    test_metrics<thread_pool<int, true, task_queue<int>, pool_metrics<1, true>>>("pool_2M", 2u);
+
     test_serial_exceptions();
     test_serial_execution();
   }
@@ -90,6 +116,230 @@ namespace sequoia::testing
     }
   }
 
+  void threading_models_test::test_bounded_task_queue()
+  {
+    STATIC_CHECK(!bounded_capacity<0>);
+    STATIC_CHECK(!bounded_capacity<1>);
+    STATIC_CHECK(bounded_capacity<2>);
+    STATIC_CHECK(!bounded_capacity<3>);
+
+    using q_t = bounded_task_queue<int, 2>;
+    using task_t = q_t::task_t;
+
+    q_t q{};
+
+    check("", q.push(task_t{[](){ return 1; }}, std::try_to_lock));
+    check("", q.push(task_t{[](){ return 2; }}, std::try_to_lock));
+
+    task_t rejected{[](){ return 3; }};
+    check("Full queue", !q.push(std::move(rejected), std::try_to_lock));
+    check("Rejected task is not moved from", rejected.valid());
+
+    auto t{q.pop(std::try_to_lock)};
+    auto fut{t.get_future()};
+    t();
+    check(equality, "First in, first out", fut.get(), 1);
+
+    check("Space freed by pop", q.push(std::move(rejected), std::try_to_lock));
+
+    t = q.pop();
+    fut = t.get_future();
+    t();
+    check(equality, "", fut.get(), 2);
+
+    t = q.pop();
+    fut = t.get_future();
+    t();
+    check(equality, "", fut.get(), 3);
+
+    check("Empty queue", !q.pop(std::try_to_lock).valid());
+
+    q.finish();
+    check("Pop after finish", !q.pop().valid());
+  }
+
+  void threading_models_test::test_bounded_pool_backpressure()
+  {
+    constexpr std::size_t numProducers{4}, tasksPerProducer{500};
+
+    std::atomic<std::size_t> total{};
+    {
+      thread_pool<void, false, bounded_task_queue<void, 8>> pool{2};
+      std::vector<std::thread> producers{};
+      for(std::size_t p{}; p < numProducers; ++p)
+      {
+        producers.emplace_back([&pool, &total]() {
+          for(std::size_t i{}; i < tasksPerProducer; ++i)
+            (void)pool.push([&total]() { ++total; });
+        });
+      }
+
+      for(auto& t : producers) t.join();
+    }
+
+    check(equality, "All tasks pushed to a small queue are executed", total.load(), numProducers * tasksPerProducer);
+  }
+
+  void threading_models_test::test_priority_task_queue()
+  {
+    using namespace std::chrono_literals;
+
+    {
+      using q_t = priority_task_queue<int, 3, 0>;
+      using task_t = q_t::task_t;
+
+      q_t q{};
+      q.push(task_t{[](){ return 1; }});
+      q.push(task_t{[](){ return 2; }}, {.level{1}});
+      q.push(task_t{[](){ return 3; }}, {.level{0}});
+      q.push(task_t{[](){ return 4; }}, {.level{0}, .deadline{task_clock::now() + 1s}});
+
+      std::vector<int> order{};
+      for(int i{}; i < 4; ++i)
+      {
+        auto t{q.pop()};
+        auto fut{t.get_future()};
+        t();
+        order.push_back(fut.get());
+      }
+
+      check(equality, "Highest class first; earliest deadline first within a class", order, std::vector<int>{4, 3, 2, 1});
+      check(equality, "Wait times recorded for class 0", q.wait_times(0).total(), std::size_t{2});
+      check(equality, "Wait times recorded for class 2", q.wait_times(2).total(), std::size_t{1});
+      check_exception_thrown<std::out_of_range>("Level out of range", [&q](){ q.push(task_t{[](){ return 5; }}, {.level{3}}); });
+
+      q.finish();
+      check("Pop after finish", !q.pop().valid());
+    }
+
+    {
+      using q_t = priority_task_queue<int, 2, 1>;
+      using task_t = q_t::task_t;
+
+      q_t q{};
+      q.push(task_t{[](){ return 1; }});
+      std::this_thread::sleep_for(5ms);
+      q.push(task_t{[](){ return 2; }}, {.level{0}});
+
+      auto t{q.pop()};
+      auto fut{t.get_future()};
+      t();
+      check(equality, "Aged task overtakes a higher class", fut.get(), 1);
+    }
+
+    {
+      using q_t = priority_task_queue<int, 1, 1>;
+      using task_t = q_t::task_t;
+
+      q_t q{};
+      q.push(task_t{[](){ return 1; }}, {.level{0}});
+      std::this_thread::sleep_for(5ms);
+      q.push(task_t{[](){ return 2; }}, {.level{0}, .deadline{task_clock::now() + 1s}});
+
+      auto t{q.pop()};
+      auto fut{t.get_future()};
+      t();
+      check(equality, "Aged task without a deadline overtakes one with a deadline", fut.get(), 1);
+    }
+  }
+
+  void threading_models_test::test_prioritised_pool()
+  {
+    {
+      thread_pool<int, false, priority_task_queue<int>> pool{2};
+      auto high{pool.push([](){ return 1; }, {.level{0}})};
+      auto low{pool.push([](){ return 2; })};
+
+      check(equality, "", high.get() + low.get(), 3);
+      check(equality, "", pool.wait_times(0).total(), std::size_t{1});
+    }
+
+    {
+      thread_pool<int, true, priority_task_queue<int>> pool{2};
+      std::vector<std::future<int>> futures{};
+      for(int i{}; i < 6; ++i)
+        futures.push_back(pool.push([i](){ return i; }, {.level{static_cast<std::size_t>(i % 3)}}));
+
+      int sum{};
+      for(auto& f : futures) sum += f.get();
+
+      check(equality, "", sum, 15);
+      check(equality, "Wait times aggregated over pipelines", pool.wait_times(1).total(), std::size_t{2});
+    }
+  }
+
+  template<class ThreadModel, class... Args>
+  void threading_models_test::test_cancellation(std::string_view message, Args&&... args)
+  {
+    using namespace std::chrono_literals;
+    const std::string desc{message};
+
+    ThreadModel model{std::forward<Args>(args)...};
+    std::atomic<bool> started{};
+    auto blocker{
+      model.push([&started](std::stop_token token) {
+        started = true;
+        while(!token.stop_requested()) std::this_thread::sleep_for(1ms);
+        return -1;
+      })
+    };
+
+    while(!started) std::this_thread::sleep_for(1ms);
+
+    auto queued{model.push([](){ return 1; })};
+    model.cancel_all();
+
+    check(equality, desc + ": running task stopped", blocker.get(), -1);
+    check_exception_thrown<std::future_error>(desc + ": queued task discarded", [&queued](){ return queued.get(); });
+    check(equality, desc + ": pool usable after cancellation", model.push([](){ return 2; }).get(), 2);
+
+    auto expired{model.push([](){ return 3; }, task_clock::now() - 1ms)};
+    check_exception_thrown<task_cancelled>(desc + ": expired deadline", [&expired](){ return expired.get(); });
+    check(equality, desc + ": future deadline", model.push([](){ return 4; }, task_clock::now() + 1h).get(), 4);
+
+    auto abandoned{model.push([](){ return 5; })};
+    model.shutdown_now();
+    check(desc + ": shutdown_now resolves queued futures", abandoned.wait_for(0s) == std::future_status::ready);
+  }
+
+  template<class ThreadModel, class... Args>
+  void threading_models_test::test_metrics(std::string_view message, Args&&... args)
+  {
+    const std::string desc{message};
+    constexpr std::size_t numTasks{20};
+
+    ThreadModel model{std::forward<Args>(args)...};
+    std::vector<std::future<int>> futures{};
+    for(std::size_t i{}; i < numTasks; ++i)
+      futures.push_back(model.push([i](){ return static_cast<int>(i); }));
+
+    for(auto& f : futures) f.get();
+
+    check_exception_thrown<std::logic_error>(desc + ": trace before join", [&model](){ std::ostringstream stream{}; model.write_trace(stream); });
+
+    model.join();
+
+    const auto metrics{model.metrics()};
+    const auto executed{std::ranges::fold_left(metrics.workers, std::size_t{}, [](std::size_t n, const worker_metrics_snapshot& w) { return n + w.tasks_executed; })};
+
+    check(equality, desc + ": number of workers", metrics.workers.size(), std::size_t{2});
+    check(equality, desc + ": pushes", metrics.pushes, numTasks);
+    check(equality, desc + ": executed", executed, numTasks);
+    check(equality, desc + ": queue depth", metrics.queue_depth, std::size_t{});
+    check(equality, desc + ": sampled queue latencies", metrics.queue_latency.total(), numTasks);
+    check(equality, desc + ": sampled execution latencies", metrics.execution_latency.total(), numTasks);
+
+    std::ostringstream stream{};
+    model.write_trace(stream);
+    const auto trace{stream.str()};
+
+    std::size_t spans{};
+    for(auto pos{trace.find("\"ph\":\"X\"")}; pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1))
+      ++spans;
+
+    check(equality, desc + ": trace spans", spans, numTasks);
+  }
+
   template<class ThreadModel, class... Args>
   void threading_models_test::test_exceptions(std::string_view message, Args&&... args)
   {
@@ -28,6 +28,20 @@ namespace sequoia::testing
 
     void test_task_queue();
 
+    void test_bounded_task_queue();
+
+    void test_bounded_pool_backpressure();
+
+    void test_priority_task_queue();
+
+    void test_prioritised_pool();
+
+    template<class ThreadModel, class... Args>
+    void test_cancellation(std::string_view message, Args&&... args);
+
+    template<class ThreadModel, class... Args>
+    void test_metrics(std::string_view message, Args&&... args);
+
     template<class ThreadModel, class... Args>
     void test_exceptions(std::string_view message, Args&&... args);
 
@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "FuturesFreeTest.hpp"
+#include "sequoia/Core/Concurrency/ConcurrencyModels.hpp"
+
+#include <string>
+#include <thread>
+
+namespace sequoia::testing
+{
+  using namespace concurrency;
+
+  namespace
+  {
+    template<class Futures>
+    concept combinable = requires(Futures&& futures) {
+      when_all(std::forward<Futures>(futures));
+      when_any(std::forward<Futures>(futures));
+    };
+  }
+
+  [[nodiscard]]
+  std::filesystem::path futures_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void futures_free_test::run_tests()
+  {
+    test_ready_futures();
+    test_continuations();
+    test_when_all();
+    test_when_any();
+    test_pool_spawn();
+  }
+
+  void futures_free_test::test_ready_futures()
+  {
+    check("Default future is invalid", !future<int>{}.valid());
+
+    auto f{make_ready_future<int>(2)};
+    check("Ready future", f.is_ready());
+    check(equality, "Ready value", f.get(), 2);
+    check("Consumed by get", !f.valid());
+    check_exception_thrown<std::future_error>("No state", [&f](){ return f.get(); });
+
+    check(equality,
+          "Chained continuations on a ready future",
+          make_ready_future<int>(2).then([](int x) { return x * 3; }).then([](int x) { return std::to_string(x); }).get(),
+          std::string{"6"});
+
+    auto thrown{make_exceptional_future<int>(std::make_exception_ptr(std::runtime_error{"Error"}))};
+    bool invoked{};
+    auto propagated{std::move(thrown).then([&invoked](int) { invoked = true; })};
+    check_exception_thrown<std::runtime_error>("Exception propagates past continuation", [&propagated](){ propagated.get(); });
+    check("Continuation not invoked", !invoked);
+  }
+
+  void futures_free_test::test_continuations()
+  {
+    {
+      promise<int> p{};
+      auto f{p.get_future().then([](int x) { return x + 1; })};
+      check("Not ready before the promise is fulfilled", !f.is_ready());
+
+      std::jthread worker{[&p]() { p.set_value(41); }};
+      check(equality, "Continuation of value set on another thread", f.get(), 42);
+    }
+
+    {
+      promise<void> p{};
+      auto f{p.get_future().then([]() -> int { throw std::logic_error{"Error"}; })};
+      p.set_value();
+      check_exception_thrown<std::logic_error>("Exception thrown by continuation", [&f](){ return f.get(); });
+      check_exception_thrown<std::future_error>("Promise already satisfied", [&p](){ p.set_value(); });
+    }
+
+    {
+      std::optional<promise<int>> p{std::in_place};
+      auto f{p->get_future()};
+      check_exception_thrown<std::future_error>("Future already retrieved", [&p](){ return p->get_future(); });
+
+      p.reset();
+      check_exception_thrown<std::future_error>("Broken promise", [&f](){ return f.get(); });
+    }
+  }
+
+  void futures_free_test::test_when_all()
+  {
+    STATIC_CHECK(combinable<std::vector<future<int>>>);
+    STATIC_CHECK(!combinable<std::vector<future<int>>&>);
+
+    {
+      std::vector<future<int>> futures{};
+      check(equality, "Empty", when_all(std::move(futures)).get(), std::vector<int>{});
+    }
+
+    {
+      std::vector<future<int>> futures{};
+      for(int i{}; i < 3; ++i) futures.push_back(make_ready_future<int>(i));
+
+      auto f{when_all(std::move(futures))};
+      check("All ready", f.is_ready());
+      check(equality, "Values of ready futures", f.get(), std::vector<int>{0, 1, 2});
+    }
+
+    {
+      std::vector<promise<int>> promises(4);
+      std::vector<future<int>> futures{};
+      for(auto& p : promises) futures.push_back(p.get_future());
+
+      auto f{when_all(std::move(futures))};
+      {
+        std::vector<std::jthread> workers{};
+        for(int i{3}; i >= 0; --i)
+          workers.emplace_back([&promises, i]() { promises[i].set_value(i * 10); });
+      }
+
+      check(equality, "Values in order, regardless of order of completion", f.get(), std::vector<int>{0, 10, 20, 30});
+    }
+
+    {
+      std::vector<promise<void>> promises(2);
+      std::vector<future<void>> futures{};
+      for(auto& p : promises) futures.push_back(p.get_future());
+
+      auto f{when_all(std::move(futures))};
+      promises[1].set_exception(std::make_exception_ptr(std::runtime_error{"Error"}));
+      check("Not ready until all are", !f.is_ready());
+
+      promises[0].set_value();
+      check_exception_thrown<std::runtime_error>("Exception propagated", [&f](){ f.get(); });
+    }
+  }
+
+  void futures_free_test::test_when_any()
+  {
+    {
+      std::vector<future<int>> futures{};
+      check_exception_thrown<std::logic_error>("Empty", [&futures](){ return when_any(std::move(futures)); });
+    }
+
+    {
+      promise<int> p{};
+      std::vector<future<int>> futures{};
+      futures.push_back(p.get_future());
+      futures.push_back(make_ready_future<int>(7));
+
+      auto f{when_any(std::move(futures))};
+      check("Ready if any future is", f.is_ready());
+
+      const auto result{f.get()};
+      check(equality, "Index of ready future", result.index, std::size_t{1});
+      check(equality, "Value of ready future", result.value, 7);
+    }
+
+    {
+      std::vector<promise<int>> promises(3);
+      std::vector<future<int>> futures{};
+      for(auto& p : promises) futures.push_back(p.get_future());
+
+      auto f{when_any(std::move(futures))};
+      promises[2].set_value(20);
+      promises[0].set_value(0);
+
+      const auto result{f.get()};
+      check(equality, "Index of first to complete", result.index, std::size_t{2});
+      check(equality, "Value of first to complete", result.value, 20);
+    }
+  }
+
+  void futures_free_test::test_pool_spawn()
+  {
+    {
+      thread_pool<int> pool{2};
+      std::vector<future<int>> futures{};
+      for(int i{}; i < 100; ++i) futures.push_back(pool.spawn([i]() { return i; }));
+
+      auto total{
+        when_all(std::move(futures)).then([](std::vector<int> v) {
+          return std::ranges::fold_left(v, 0, std::plus{});
+        })
+      };
+
+      check(equality, "Sum of spawned tasks", total.get(), 4950);
+    }
+
+    {
+      thread_pool<void> pool{2};
+      auto f{pool.spawn([](){}).then(pool, [](){ return 5; })};
+      check(equality, "Continuation pushed to the pool", f.get(), 5);
+
+      auto thrown{pool.spawn([](std::stop_token) { throw std::runtime_error{"Error"}; })};
+      check_exception_thrown<std::runtime_error>("Exception thrown by spawned task", [&thrown](){ thrown.get(); });
+    }
+
+    {
+      thread_pool<int, false> pool{1};
+      std::promise<void> started{}, gate{};
+      auto blocker{pool.push([&started, &gate]() { started.set_value(); gate.get_future().wait(); return 0; })};
+      auto queued{pool.spawn([]() { return 1; })};
+
+      started.get_future().wait();
+      pool.cancel_all();
+      gate.set_value();
+
+      check(equality, "Running task completes", blocker.get(), 0);
+      check_exception_thrown<task_cancelled>("Queued task discarded", [&queued](){ return queued.get(); });
+    }
+
+    {
+      thread_pool<void, false> pool{1};
+      std::promise<void> started{}, gate{};
+      auto blocker{pool.push([&started, &gate]() { started.set_value(); gate.get_future().wait(); })};
+      auto queued{make_ready_future<int>(1).then(pool, [](int i) { return i; })};
+
+      started.get_future().wait();
+      pool.cancel_all();
+      gate.set_value();
+
+      blocker.get();
+      check_exception_thrown<task_cancelled>("Queued continuation discarded", [&queued](){ return queued.get(); });
+    }
+
+    {
+      struct no_default
+      {
+        explicit no_default(int i) : value{i} {}
+
+        int value;
+      };
+
+      thread_pool<no_default> pool{2};
+      check(equality, "Spawned task without a default-constructible result", pool.spawn([]() { return no_default{42}; }).get().value, 42);
+    }
+  }
+}
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "TopologyFreeTest.hpp"
+#include "TopologyTestingUtilities.hpp"
+
+namespace sequoia::testing
+{
+  using namespace concurrency;
+
+  namespace
+  {
+    using indices = std::vector<std::size_t>;
+  }
+
+  [[nodiscard]]
+  std::filesystem::path topology_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void topology_free_test::run_tests()
+  {
+    test_cpu_list();
+    test_detection();
+    test_worker_layout();
+  }
+
+  void topology_free_test::test_cpu_list()
+  {
+    check(equality, "Empty", parse_cpu_list(""), indices{});
+    check(equality, "Single cpu", parse_cpu_list("3"), indices{3});
+    check(equality, "Ranges and singletons", parse_cpu_list("0-2,5,7-8\n"), indices{0, 1, 2, 5, 7, 8});
+
+    check_exception_thrown<std::runtime_error>("Decreasing range", [](){ return parse_cpu_list("3-1"); });
+    check_exception_thrown<std::runtime_error>("Not a number", [](){ return parse_cpu_list("0,a"); });
+    check_exception_thrown<std::runtime_error>("Trailing comma", [](){ return parse_cpu_list("0,"); });
+  }
+
+  void topology_free_test::test_detection()
+  {
+    // node2 has memory but no cpus, so is dropped and the distances re-indexed
+    check(equality,
+          "Two nodes with cpus",
+          detect_cpu_topology(working_materials() / "TwoNodes"),
+          cpu_topology{{{.id{0}, .cpus{0, 1, 4}, .distances{10, 21}},
+                        {.id{1}, .cpus{2, 3},    .distances{21, 10}}}});
+
+    const auto fallback{detect_cpu_topology(working_materials() / "Missing")};
+    check(equality, "Fallback to a single node", fallback.nodes.size(), std::size_t{1});
+    check("Fallback node has cpus", fallback.num_cpus() > 0);
+  }
+
+  void topology_free_test::test_worker_layout()
+  {
+    check(equality,
+          "Without a topology, workers visit the pipelines in turn",
+          make_worker_layout(3).steal_order,
+          std::vector<indices>{{0, 1, 2}, {1, 2, 0}, {2, 0, 1}});
+
+    const cpu_topology topology{{{.id{0}, .cpus{0, 1}, .distances{10, 21, 31}},
+                                 {.id{1}, .cpus{2, 3}, .distances{21, 10, 21}},
+                                 {.id{2}, .cpus{4, 5}, .distances{31, 21, 10}}}};
+
+    const auto layout{make_worker_layout(topology, 6)};
+    check(equality,
+          "Workers spread over the cpus",
+          layout.workers,
+          std::vector<worker_slot>{{0, 0}, {0, 1}, {1, 2}, {1, 3}, {2, 4}, {2, 5}});
+
+    check(equality,
+          "Own pipeline, then local, then remote by distance",
+          layout.steal_order,
+          std::vector<indices>{{0, 1, 2, 3, 4, 5},
+                               {1, 0, 2, 3, 4, 5},
+                               {2, 3, 4, 5, 0, 1},
+                               {3, 2, 4, 5, 0, 1},
+                               {4, 5, 2, 3, 0, 1},
+                               {5, 4, 2, 3, 0, 1}});
+
+    check(equality,
+          "More workers than cpus",
+          make_worker_layout(topology, 12).workers.size(),
+          std::size_t{12});
+  }
+}
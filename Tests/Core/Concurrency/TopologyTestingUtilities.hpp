@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file */
+
+#include "sequoia/TestFramework/RegularTestCore.hpp"
+#include "sequoia/Core/Concurrency/Topology.hpp"
+
+namespace sequoia::testing
+{
+  template<> struct value_tester<concurrency::numa_node>
+  {
+    using type = concurrency::numa_node;
+
+    template<test_mode Mode>
+    static void test(equality_check_t, test_logger<Mode>& logger, const type& actual, const type& prediction)
+    {
+      check(equality, "Id", logger, actual.id, prediction.id);
+      check(equality, "Cpus", logger, actual.cpus, prediction.cpus);
+      check(equality, "Distances", logger, actual.distances, prediction.distances);
+    }
+  };
+
+  template<> struct value_tester<concurrency::cpu_topology>
+  {
+    using type = concurrency::cpu_topology;
+
+    template<test_mode Mode>
+    static void test(equality_check_t, test_logger<Mode>& logger, const type& actual, const type& prediction)
+    {
+      check(equality, "Nodes", logger, actual.nodes, prediction.nodes);
+    }
+  };
+
+  template<> struct value_tester<concurrency::worker_slot>
+  {
+    using type = concurrency::worker_slot;
+
+    template<test_mode Mode>
+    static void test(equality_check_t, test_logger<Mode>& logger, const type& actual, const type& prediction)
+    {
+      check(equality, "Node", logger, actual.node, prediction.node);
+      check(equality, "Cpu", logger, actual.cpu, prediction.cpu);
+    }
+  };
+}
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "MemoryResourcesFreeTest.hpp"
+#include "MemoryResourcesTestingUtilities.hpp"
+
+#include "sequoia/Core/Memory/MemoryResources.hpp"
+#include "sequoia/Core/Object/Handlers.hpp"
+#include "sequoia/Maths/Graph/DynamicGraph.hpp"
+
+namespace sequoia::testing
+{
+  [[nodiscard]]
+  std::filesystem::path memory_resources_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void memory_resources_free_test::run_tests()
+  {
+    test_fixed_size_pool();
+    test_monotonic_arena();
+    test_counted_ptr();
+  }
+
+  void memory_resources_free_test::test_fixed_size_pool()
+  {
+    using namespace memory;
+
+    check_exception_thrown<std::logic_error>("No blocks per chunk", [](){ fixed_size_pool{8, 0}; });
+    check_exception_thrown<std::logic_error>("Null upstream", [](){ fixed_size_pool{8, 4, nullptr}; });
+
+    counting_resource upstream{};
+
+    {
+      fixed_size_pool pool{3 * sizeof(int), 2, &upstream};
+      check(equality, "Block size rounded up", pool.block_size(), alignof(std::max_align_t));
+      check(equality, "", upstream.allocs(), 0);
+
+      void* p0{pool.allocate(sizeof(int))};
+      void* p1{pool.allocate(3 * sizeof(int))};
+      check(equality, "One chunk for two blocks", upstream.allocs(), 1);
+      check(equality, "", pool.num_chunks(), std::size_t{1});
+
+      void* p2{pool.allocate(sizeof(int))};
+      check(equality, "Second chunk", upstream.allocs(), 2);
+
+      pool.deallocate(p1, 3 * sizeof(int));
+      void* p3{pool.allocate(2 * sizeof(int))};
+      check("Freed block reused", p1 == p3);
+      check(equality, "No further chunks", upstream.allocs(), 2);
+
+      void* pBig{pool.allocate(1024)};
+      check(equality, "Oversized requests forwarded", upstream.allocs(), 3);
+      pool.deallocate(pBig, 1024);
+      check(equality, "", upstream.deallocs(), 1);
+
+      pool.deallocate(p0, sizeof(int));
+      pool.deallocate(p2, sizeof(int));
+      pool.deallocate(p3, 2 * sizeof(int));
+
+      std::pmr::vector<int> v{&pool};
+      v.push_back(1);
+      check(equality, "Container served from pool", upstream.allocs(), 3);
+    }
+
+    check(equality, "Chunks returned upstream", upstream.deallocs(), upstream.allocs());
+  }
+
+  void memory_resources_free_test::test_monotonic_arena()
+  {
+    using namespace maths;
+    using graph_type = directed_graph<null_weight, null_weight, pmr_bucketed_edge_storage_config>;
+    using edge_allocator = graph_type::edge_allocator_type;
+
+    constexpr std::size_t nodes{100};
+
+    auto build{
+      [](graph_type& g) {
+        for(std::size_t i{}; i < nodes; ++i) g.add_node();
+        for(std::size_t i{}; i < nodes; ++i)
+        {
+          g.join(i, (i + 1) % nodes);
+          g.join(i, (i + 2) % nodes);
+        }
+      }
+    };
+
+    counting_resource upstream{};
+    {
+      graph_type g{edge_allocator{&upstream}};
+      build(g);
+      check(equality, "", g.order(), nodes);
+      check(equality, "", g.size(), 2 * nodes);
+      check("At least one allocation per node", upstream.allocs() > static_cast<int>(nodes));
+    }
+
+    counting_resource arenaUpstream{};
+    {
+      memory::monotonic_arena arena{&arenaUpstream};
+      graph_type g{edge_allocator{&arena}};
+      build(g);
+      check(equality, "", g.order(), nodes);
+      check(equality, "", g.size(), 2 * nodes);
+      check("Arena amortizes allocations", arenaUpstream.allocs() < upstream.allocs() / 10);
+    }
+
+    check(equality, "Arena releases everything", arenaUpstream.deallocs(), arenaUpstream.allocs());
+  }
+
+  void memory_resources_free_test::test_counted_ptr()
+  {
+    using namespace object;
+
+    counting_resource upstream{};
+    {
+      memory::fixed_size_pool pool{64, 4, &upstream};
+      struct pool_resource
+      {
+        static std::pmr::memory_resource*& get() noexcept
+        {
+          static std::pmr::memory_resource* pResource{};
+          return pResource;
+        }
+      };
+
+      pool_resource::get() = &pool;
+
+      using handler = counted_shared<std::pair<int, double>, pool_resource>;
+      static_assert(object::handler<handler>);
+
+      handler::product_type p{handler::producer_type::make(1, 2.0)};
+      check(equality, "", handler::get(p), std::pair<int, double>{1, 2.0});
+      check(equality, "", p.use_count(), std::size_t{1});
+
+      {
+        auto q{p};
+        check(equality, "Copies share", p.use_count(), std::size_t{2});
+        check("", handler::get_ptr(p) == handler::get_ptr(q));
+
+        handler::get(q).first = 3;
+        check(equality, "", handler::get(p).first, 3);
+      }
+
+      check(equality, "", p.use_count(), std::size_t{1});
+
+      auto r{std::move(p)};
+      check("Moved-from pointer is null", !p);
+      check(equality, "", r.use_count(), std::size_t{1});
+      check(equality, "Single allocation for control block and object", upstream.allocs(), 1);
+
+      pool_resource::get() = nullptr;
+
+      counted_ptr<int> explicitResource{std::allocator_arg, &pool, 5};
+      check(equality, "Explicit resource", *explicitResource, 5);
+      check(equality, "Explicit resource draws from the existing chunk", pool.num_chunks(), std::size_t{1});
+    }
+
+    check(equality, "", upstream.deallocs(), upstream.allocs());
+
+    counting_resource defaultResource{};
+    {
+      auto pPrevious{std::pmr::set_default_resource(&defaultResource)};
+      counted_ptr<int> p{std::in_place, 1};
+      std::pmr::set_default_resource(pPrevious);
+
+      check(equality, "The process-wide default resource is not consulted", defaultResource.allocs(), 0);
+    }
+  }
+}
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file */
+
+#include "sequoia/TestFramework/FreeTestCore.hpp"
+
+namespace sequoia::testing
+{
+  class memory_resources_free_test final : public free_test
+  {
+  public:
+    using free_test::free_test;
+
+    [[nodiscard]]
+    std::filesystem::path source_file() const;
+
+    void run_tests();
+  private:
+    void test_fixed_size_pool();
+
+    void test_monotonic_arena();
+
+    void test_counted_ptr();
+  };
+}
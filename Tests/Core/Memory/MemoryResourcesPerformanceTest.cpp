@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "MemoryResourcesPerformanceTest.hpp"
+
+#include "sequoia/Core/Memory/MemoryResources.hpp"
+#include "sequoia/Maths/Graph/DynamicGraph.hpp"
+
+namespace sequoia::testing
+{
+  namespace
+  {
+    constexpr std::size_t num_partitions{20000};
+
+    template<class Storage, class... Allocators>
+    std::size_t fill_partitions(const Allocators&... allocators)
+    {
+      Storage s(allocators...);
+      for(std::size_t i{}; i < num_partitions; ++i)
+      {
+        s.add_slot();
+        s.push_back_to_partition(i, static_cast<int>(i));
+        s.push_back_to_partition(i, static_cast<int>(i + 1));
+      }
+
+      return s.size();
+    }
+
+    template<class EdgeStorageConfig, class... Allocators>
+    std::size_t build_graph(const Allocators&... allocators)
+    {
+      using graph_type = maths::undirected_graph<maths::null_weight, maths::null_weight, maths::null_meta_data, EdgeStorageConfig>;
+
+      graph_type g(allocators...);
+      for(std::size_t i{}; i < num_partitions; ++i) g.add_node();
+      for(std::size_t i{}; i < num_partitions; ++i) g.join(i, (i + 1) % num_partitions);
+
+      return g.size();
+    }
+  }
+
+  [[nodiscard]]
+  std::filesystem::path memory_resources_performance_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void memory_resources_performance_test::run_tests()
+  {
+    test_bucketed_sequence_construction();
+    test_graph_construction();
+  }
+
+  void memory_resources_performance_test::test_bucketed_sequence_construction()
+  {
+    using namespace data_structures;
+    using pmr_storage = pmr::bucketed_sequence<int>;
+    using allocator   = pmr_storage::allocator_type;
+
+    auto arenaFn{
+      [](){
+        memory::monotonic_arena arena{};
+        return fill_partitions<pmr_storage>(allocator{&arena});
+      }
+    };
+
+    auto poolFn{
+      [](){
+        memory::fixed_size_pool pool{2 * sizeof(int), 1024};
+        return fill_partitions<pmr_storage>(allocator{&pool});
+      }
+    };
+
+    auto defaultFn{[](){ return fill_partitions<bucketed_sequence<int>>(); }};
+
+    // Measured speed-ups are around 1.3 for the arena and 2.1 for the pool
+    check_relative_performance("Bucketed sequence construction; arena/default", arenaFn, defaultFn, 1.1, 2.0);
+    check_relative_performance("Bucketed sequence construction; pool/default", poolFn, defaultFn, 1.5, 3.0);
+  }
+
+  void memory_resources_performance_test::test_graph_construction()
+  {
+    using namespace maths;
+
+    auto arenaFn{
+      [](){
+        memory::monotonic_arena arena{};
+        return build_graph<pmr_bucketed_edge_storage_config>(std::pmr::polymorphic_allocator<>{&arena});
+      }
+    };
+
+    auto defaultFn{[](){ return build_graph<bucketed_edge_storage_config>(); }};
+
+    // Allocation is not the bottleneck and no consistent speed-up has been measured
+    report_relative_performance("Undirected graph construction; arena/default", arenaFn, defaultFn);
+  }
+}
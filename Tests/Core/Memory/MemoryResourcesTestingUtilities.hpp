@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file */
+
+#include "sequoia/TestFramework/RegularAllocationTestCore.hpp"
+
+#include <memory_resource>
+
+namespace sequoia::testing
+{
+  /*! \brief Upstream resource which counts (de)allocations via a shared_counting_allocator */
+  class counting_resource final : public std::pmr::memory_resource
+  {
+  public:
+    [[nodiscard]]
+    int allocs() const noexcept { return m_Allocator.allocs(); }
+
+    [[nodiscard]]
+    int deallocs() const noexcept { return m_Allocator.deallocs(); }
+  private:
+    shared_counting_allocator<std::max_align_t> m_Allocator{};
+
+    [[nodiscard]]
+    static std::size_t num_blocks(const std::size_t bytes) noexcept
+    {
+      return (bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+    }
+
+    [[nodiscard]]
+    void* do_allocate(const std::size_t bytes, const std::size_t) override
+    {
+      return m_Allocator.allocate(num_blocks(bytes));
+    }
+
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t) override
+    {
+      m_Allocator.deallocate(static_cast<std::max_align_t*>(p), num_blocks(bytes));
+    }
+
+    [[nodiscard]]
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+}
@@ -17,6 +17,10 @@ namespace sequoia::testing
     template<class T, class U>
     struct comparator : std::bool_constant<sizeof(T) < sizeof(U)> {};
 
+    /// Orders as type_comparator but without opting in to sorting by name in constant evaluation
+    template<class T, class U>
+    struct recursive_type_comparator : std::bool_constant<(type_name<T>() < type_name<U>())> {};
+
     
     template<class T>
     struct is_int : std::is_same<T, int> {};
@@ -152,6 +156,10 @@ namespace sequoia::testing
     STATIC_CHECK((std::is_same_v<merge_t<TT<char, int>,  TT<char>,                comparator>, TT<char, char, int>>));
     STATIC_CHECK((std::is_same_v<merge_t<TT<char, int>,  TT<char, short>,         comparator>, TT<char, char, short, int>>));
     STATIC_CHECK((std::is_same_v<merge_t<TT<short, int>, TT<char, short, double>, comparator>, TT<char, short, short, int, double>>));
+
+    STATIC_CHECK((std::is_same_v<merge_t<TT<char, int>,  TT<double, short>,       type_comparator>, TT<char, double, int, short>>));
+    STATIC_CHECK((std::is_same_v<merge_t<TT<char, int>,  TT<double, short>,       recursive_type_comparator>, TT<char, double, int, short>>));
+    STATIC_CHECK((std::is_same_v<merge_t<TT<int>,        TT<char, int>,           type_comparator>, TT<char, int, int>>));
   }
 
   template<template<class...> class TT>
@@ -162,6 +170,14 @@ namespace sequoia::testing
     STATIC_CHECK((std::is_same_v<stable_sort_t<TT<char, int>,                comparator>, TT<char, int>>));
     STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int, char>,                comparator>, TT<char, int>>));
     STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int, char, double, short>, comparator>, TT<char, short, int, double>>));
+
+    STATIC_CHECK((std::is_same_v<stable_sort_t<TT<>,                                type_comparator>, TT<>>));
+    STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int>,                             type_comparator>, TT<int>>));
+    STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int, char>,                       type_comparator>, TT<char, int>>));
+    STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int, char, double, short, float>, type_comparator>, TT<char, double, float, int, short>>));
+    STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int, char, int, char>,            type_comparator>, TT<char, char, int, int>>));
+    STATIC_CHECK((std::is_same_v<stable_sort_t<TT<int, char, double, short, float>, type_comparator>,
+                                 stable_sort_t<TT<int, char, double, short, float>, recursive_type_comparator>>));
   }
 
   template<template<class...> class TT>
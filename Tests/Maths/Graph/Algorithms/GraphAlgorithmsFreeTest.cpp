@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "GraphAlgorithmsFreeTest.hpp"
+#include "GraphAlgorithmsTestingUtilities.hpp"
+
+#include <random>
+
+namespace sequoia::testing
+{
+  using namespace maths;
+
+  namespace
+  {
+    using directed_type   = directed_graph<null_weight, null_weight>;
+    using undirected_type = undirected_graph<null_weight, null_weight>;
+    using size_type       = directed_type::size_type;
+    using indices         = std::vector<size_type>;
+
+    template<class G>
+    [[nodiscard]]
+    G make_graph(size_type order, std::initializer_list<std::pair<size_type, size_type>> edges)
+    {
+      G g{};
+      for(size_type i{}; i < order; ++i) g.add_node();
+      for(const auto& [from, to] : edges) g.join(from, to);
+
+      return g;
+    }
+
+    /// Chains which are far too long for a recursive traversal
+    [[nodiscard]]
+    directed_type make_chain(size_type order, bool closed)
+    {
+      directed_type g{};
+      g.reserve_nodes(order);
+      for(size_type i{}; i < order; ++i) g.add_node();
+      for(size_type i{}; i + 1 < order; ++i) g.join(i, i + 1);
+      if(closed) g.join(order - 1, 0);
+
+      return g;
+    }
+  }
+
+  [[nodiscard]]
+  std::filesystem::path graph_algorithms_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void graph_algorithms_free_test::run_tests()
+  {
+    test_strongly_connected_components();
+    test_topological_sort();
+    test_find_cycle();
+    test_connected_components(0, "Serial");
+    test_connected_components(4, "Pool");
+    test_incremental_components();
+  }
+
+  void graph_algorithms_free_test::test_strongly_connected_components()
+  {
+    {
+      const auto components{strongly_connected_components(directed_type{})};
+      check(equality, "Empty graph", components.num_components(), size_type{});
+    }
+
+    {
+      // Graph:
+      // 0 -> 1 -> 2 -> 0
+      //           2 -> 3 <-> 4
+      // 5 -> 5
+
+      const auto g{make_graph<directed_type>(6, {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 3}, {5, 5}})};
+      const auto components{strongly_connected_components(g)};
+
+      check(equality, "Number of components", components.num_components(), size_type{3});
+      check(equality, "Components, in reverse topological order", components.component_of, indices{1, 1, 1, 0, 0, 2});
+    }
+
+    {
+      const auto g{make_graph<undirected_type>(5, {{0, 1}, {3, 4}})};
+      const auto components{strongly_connected_components(g)};
+
+      check(equality, "Connected components of an undirected graph", components.component_of, indices{0, 0, 1, 2, 2});
+    }
+
+    {
+      const auto components{strongly_connected_components(make_chain(1'000'000, true))};
+      check(equality, "Long cycle", components.num_components(), size_type{1});
+    }
+  }
+
+  void graph_algorithms_free_test::test_topological_sort()
+  {
+    check(equality, "Empty graph", topological_sort(directed_type{}), std::optional<indices>{indices{}});
+
+    // Graph:
+    // 3 -> 1 -> 0
+    // 2 -> 0
+
+    check(equality,
+          "Sources in index order, followed by their successors",
+          topological_sort(make_graph<directed_type>(4, {{3, 1}, {1, 0}, {2, 0}})),
+          std::optional<indices>{indices{2, 3, 1, 0}});
+
+    // Graph:
+    // 0 -> 1
+    // 2
+
+    check(equality,
+          "Sources precede released nodes of lower index",
+          topological_sort(make_graph<directed_type>(3, {{0, 1}})),
+          std::optional<indices>{indices{0, 2, 1}});
+
+    check(equality, "Cycle", topological_sort(make_graph<directed_type>(3, {{0, 1}, {1, 2}, {2, 1}})), std::optional<indices>{});
+    check(equality, "Self loop", topological_sort(make_graph<directed_type>(1, {{0, 0}})), std::optional<indices>{});
+
+    const auto order{topological_sort(make_chain(1'000'000, false))};
+    check("Long chain", order.has_value());
+    if(order) check(equality, "Long chain ends at the last node", order->back(), size_type{999'999});
+  }
+
+  void graph_algorithms_free_test::test_find_cycle()
+  {
+    check(equality, "Empty graph", find_cycle(directed_type{}), indices{});
+    check(equality, "Acyclic", find_cycle(make_graph<directed_type>(3, {{0, 1}, {0, 2}, {1, 2}})), indices{});
+    check(equality, "Self loop", find_cycle(make_graph<directed_type>(2, {{0, 1}, {1, 1}})), indices{1});
+    check(equality, "Cycle reached from an acyclic prefix", find_cycle(make_graph<directed_type>(4, {{0, 1}, {1, 2}, {2, 3}, {3, 1}})), indices{1, 2, 3});
+    check(equality, "Long cycle", find_cycle(make_chain(1'000'000, true)).size(), std::size_t{1'000'000});
+  }
+
+  void graph_algorithms_free_test::test_connected_components(std::size_t numThreads, std::string_view description)
+  {
+    const std::string desc{description};
+
+    check(equality, desc + ": empty graph", connected_components(undirected_type{}, numThreads).num_components(), size_type{});
+
+    {
+      // Graph:
+      // 0 - 3 - 4    1 - 5    2
+
+      const auto components{connected_components(make_graph<undirected_type>(6, {{0, 3}, {3, 4}, {1, 5}}), numThreads)};
+      check(equality, desc + ": labelled in order of lowest node", components.component_of, indices{0, 1, 2, 0, 0, 1});
+      check(equality, desc + ": sizes", components.component_sizes, indices{3, 2, 1});
+    }
+
+    {
+      // Sparse enough to leave many components, and large enough to span several blocks of nodes
+      constexpr size_type order{1 << 16};
+      std::mt19937_64 gen{order};
+      std::uniform_int_distribution<size_type> dist{0, order - 1};
+
+      undirected_type g{};
+      g.reserve_nodes(order);
+      for(size_type i{}; i < order; ++i) g.add_node();
+      for(size_type i{}; i < 3 * order / 4; ++i) g.join(dist(gen), dist(gen));
+
+      const auto components{connected_components(g, numThreads)};
+      const auto expected{strongly_connected_components(g)};
+      check(equality, desc + ": number of components", components.num_components(), expected.num_components());
+
+      bool consistent{true};
+      for(size_type n{}; n < order; ++n)
+      {
+        for(auto i{g.cbegin_edges(n)}; i != g.cend_edges(n); ++i)
+          consistent = consistent && (components.component_of[n] == components.component_of[i->target_node()]);
+      }
+
+      check(desc + ": neighbours share a component", consistent);
+    }
+  }
+
+  void graph_algorithms_free_test::test_incremental_components()
+  {
+    undirected_type g{};
+    concurrent_disjoint_sets<size_type> sets{};
+
+    auto add_node{[&]() { g.add_node(); sets.add_elements(1); }};
+    auto join{[&](size_type a, size_type b) { g.join(a, b); sets.unite(a, b); }};
+
+    for(int i{}; i < 4; ++i) add_node();
+    join(0, 2);
+    check(equality, "Initial components", sets.components(), connected_components(g, 0));
+
+    add_node();
+    join(4, 1);
+    join(3, 2);
+    check(equality, "After growth", sets.components(), connected_components(g, 0));
+    check("Same set", sets.same_set(0, 3));
+    check("Different sets", !sets.same_set(0, 1));
+  }
+}
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "GraphAlgorithmsPerformanceTest.hpp"
+
+#include "sequoia/Maths/Graph/GraphAlgorithms.hpp"
+
+#include <random>
+
+namespace sequoia::testing
+{
+  using namespace maths;
+
+  namespace
+  {
+    using graph_type = directed_graph<null_weight, null_weight>;
+    using size_type  = graph_type::size_type;
+
+    constexpr size_type edges_per_node{8};
+
+    /// If `acyclic`, every edge leads from a lower to a higher index
+    [[nodiscard]]
+    graph_type make_random_graph(size_type order, bool acyclic)
+    {
+      std::mt19937_64 gen{order};
+      std::uniform_int_distribution<size_type> dist{0, order - 1};
+
+      graph_type g{};
+      g.reserve_nodes(order);
+      for(size_type i{}; i < order; ++i) g.add_node();
+
+      for(size_type i{}; i < order * edges_per_node; ++i)
+      {
+        const auto from{dist(gen)}, to{dist(gen)};
+        if(!acyclic)         g.join(from, to);
+        else if(from != to) g.join(std::min(from, to), std::max(from, to));
+      }
+
+      return g;
+    }
+  }
+
+  [[nodiscard]]
+  std::filesystem::path graph_algorithms_performance_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void graph_algorithms_performance_test::run_tests()
+  {
+    test_structural_algorithms();
+    test_connected_components();
+  }
+
+  void graph_algorithms_performance_test::test_structural_algorithms()
+  {
+    // Each algorithm is linear in V + E, so a graph with eight times as many nodes and edges,
+    // the larger having around a million edges, should take about eight times as long
+    constexpr size_type smallOrder{1 << 14}, largeOrder{8 * smallOrder};
+    constexpr double minRatio{3}, maxRatio{30};
+
+    const auto smallCyclic{make_random_graph(smallOrder, false)}, largeCyclic{make_random_graph(largeOrder, false)};
+    const auto smallAcyclic{make_random_graph(smallOrder, true)}, largeAcyclic{make_random_graph(largeOrder, true)};
+
+    check_relative_performance(
+      "Strongly connected components; small/large",
+      [&smallCyclic](){ return strongly_connected_components(smallCyclic).num_components(); },
+      [&largeCyclic](){ return strongly_connected_components(largeCyclic).num_components(); },
+      minRatio,
+      maxRatio
+    );
+
+    check_relative_performance(
+      "Topological sort; small/large",
+      [&smallAcyclic](){ return topological_sort(smallAcyclic).has_value(); },
+      [&largeAcyclic](){ return topological_sort(largeAcyclic).has_value(); },
+      minRatio,
+      maxRatio
+    );
+
+    check_relative_performance(
+      "Find cycle in acyclic graph; small/large",
+      [&smallAcyclic](){ return find_cycle(smallAcyclic).size(); },
+      [&largeAcyclic](){ return find_cycle(largeAcyclic).size(); },
+      minRatio,
+      maxRatio
+    );
+  }
+
+  void graph_algorithms_performance_test::test_connected_components()
+  {
+    // Any speed-up depends on the number of hardware threads, so the timings are only reported
+    constexpr std::size_t numThreads{4};
+
+    constexpr size_type order{1 << 20};
+    std::mt19937_64 gen{order};
+    std::uniform_int_distribution<size_type> dist{0, order - 1};
+
+    undirected_graph<null_weight, null_weight> g{};
+    g.reserve_nodes(order);
+    for(size_type i{}; i < order; ++i) g.add_node();
+    for(size_type i{}; i < 4 * order; ++i) g.join(dist(gen), dist(gen));
+
+    concurrency::thread_pool<void> pool{numThreads};
+    report_relative_performance(
+      "Connected components; pool/serial",
+      [&](){ return connected_components(g, pool).num_components(); },
+      [&](){ return connected_components(g, 0).num_components(); }
+    );
+  }
+}
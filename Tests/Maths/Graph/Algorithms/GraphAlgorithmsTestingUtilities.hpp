@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file */
+
+#include "sequoia/TestFramework/RegularTestCore.hpp"
+#include "sequoia/Maths/Graph/GraphAlgorithms.hpp"
+
+namespace sequoia::testing
+{
+  template<class SizeType>
+  struct value_tester<maths::graph_components<SizeType>>
+  {
+    using type = maths::graph_components<SizeType>;
+
+    template<test_mode Mode>
+    static void test(equality_check_t, test_logger<Mode>& logger, const type& actual, const type& prediction)
+    {
+      check(equality, "Component of each node", logger, actual.component_of, prediction.component_of);
+      check(equality, "Component sizes", logger, actual.component_sizes, prediction.component_sizes);
+    }
+  };
+}
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "TaskGraphFreeTest.hpp"
+
+#include "sequoia/Maths/Graph/DynamicGraph.hpp"
+#include "sequoia/Maths/Graph/TaskGraph.hpp"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace sequoia::testing
+{
+  namespace
+  {
+    using task_graph_type = maths::directed_graph<maths::null_weight, std::function<void()>>;
+
+    /// Executes tasks on the calling thread, but throws once a fixed number of tasks has been pushed
+    class rationed_model
+    {
+    public:
+      explicit rationed_model(std::size_t budget) : m_Budget{budget} {}
+
+      void push(std::function<void()> task)
+      {
+        if(!m_Budget) throw std::runtime_error{"Task budget exhausted"};
+
+        --m_Budget;
+        task();
+      }
+    private:
+      std::size_t m_Budget;
+    };
+  }
+
+  [[nodiscard]]
+  std::filesystem::path task_graph_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void task_graph_free_test::run_tests()
+  {
+    test_task_graph(0, "Serial");
+    test_task_graph(4, "Pool");
+    test_push_failure();
+  }
+
+  void task_graph_free_test::test_task_graph(std::size_t numThreads, std::string_view description)
+  {
+    using namespace std::chrono_literals;
+    using size_type = task_graph_type::size_type;
+    const std::string desc{description};
+
+    check(equality, desc + ": empty graph", maths::execute_task_graph(task_graph_type{}, numThreads).critical_path, std::vector<size_type>{});
+
+    std::mutex orderMutex{};
+    std::vector<size_type> order{};
+    auto recorder{
+      [&order, &orderMutex](size_type n, std::chrono::milliseconds sleep) -> std::function<void()> {
+        return [&order, &orderMutex, n, sleep]() {
+          std::this_thread::sleep_for(sleep);
+          std::scoped_lock lock{orderMutex};
+          order.push_back(n);
+        };
+      }
+    };
+
+    // Graph:
+    // 0 -> 1 -> 3
+    // 0 -> 2 -> 3
+
+    task_graph_type diamond{};
+    diamond.add_node(recorder(0, 0ms));
+    diamond.add_node(recorder(1, 20ms));
+    diamond.add_node(recorder(2, 0ms));
+    diamond.add_node(recorder(3, 0ms));
+    diamond.join(0, 1);
+    diamond.join(0, 2);
+    diamond.join(1, 3);
+    diamond.join(2, 3);
+
+    const auto report{maths::execute_task_graph(diamond, numThreads)};
+
+    check(equality, desc + ": all tasks executed", order.size(), std::size_t{4});
+    check(equality, desc + ": first task", order.front(), size_type{});
+    check(equality, desc + ": last task", order.back(), size_type{3});
+    check(equality, desc + ": critical path", report.critical_path, std::vector<size_type>{0, 1, 3});
+    check(desc + ": critical path length", report.critical_path_length >= 20ms);
+    check(desc + ": dependency respected", report.timings[3].start >= report.timings[1].finish);
+
+    task_graph_type cycle{};
+    cycle.add_node([](){});
+    cycle.add_node([](){});
+    cycle.join(0, 1);
+    cycle.join(1, 0);
+
+    check_exception_thrown<std::logic_error>(desc + ": cycle", [&cycle, numThreads]() { return maths::execute_task_graph(cycle, numThreads); });
+
+    order.clear();
+    diamond.set_node_weight(diamond.cbegin_node_weights() + 1, []() { throw std::runtime_error{"Task 1 failed"}; });
+    check_exception_thrown<std::runtime_error>(desc + ": throwing task", [&diamond, numThreads]() { return maths::execute_task_graph(diamond, numThreads); });
+    check(equality, desc + ": descendants of a throwing task are skipped", std::ranges::count(order, size_type{3}), std::ptrdiff_t{});
+
+    constexpr std::size_t chainLength{100'000};
+    std::atomic<std::size_t> numExecuted{};
+    task_graph_type chain{};
+    for(std::size_t i{}; i < chainLength; ++i)
+    {
+      chain.add_node([&numExecuted]() { ++numExecuted; });
+      if(i) chain.join(i - 1, i);
+    }
+
+    check(equality, desc + ": long chain", maths::execute_task_graph(chain, numThreads).critical_path.size(), chainLength);
+    check(equality, desc + ": long chain executed", numExecuted.load(), chainLength);
+  }
+
+  void task_graph_free_test::test_push_failure()
+  {
+    using size_type = task_graph_type::size_type;
+
+    std::vector<size_type> order{};
+    auto recorder{
+      [&order](size_type n) -> std::function<void()> {
+        return [&order, n]() { order.push_back(n); };
+      }
+    };
+
+    // Graph:
+    // 0 -> 1 -> 3
+    // 0 -> 2 -> 3
+
+    task_graph_type diamond{};
+    for(size_type n{}; n < 4; ++n)
+      diamond.add_node(recorder(n));
+
+    diamond.join(0, 1);
+    diamond.join(0, 2);
+    diamond.join(1, 3);
+    diamond.join(2, 3);
+
+    rationed_model model{2};
+    check_exception_thrown<std::runtime_error>("Push failure propagated", [&diamond, &model]() { return maths::execute_task_graph(diamond, model); });
+    check(equality, "Tasks which could not be pushed, and their descendants, are skipped", order, std::vector<size_type>{0, 1});
+  }
+}
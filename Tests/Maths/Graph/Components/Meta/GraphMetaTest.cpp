@@ -102,6 +102,12 @@ namespace sequoia::testing
     using edge_t       = typename gen_t::edge_type;
     using handler_type = shared_to_handler_t<true, EdgeWeight>;
     static_assert(std::is_same_v<edge_t, EdgeType<handler_type, EdgeMetaData, std::size_t>>);
+
+    using counted_gen_t  = edge_storage_generator<GraphFlavour, EdgeWeight, EdgeMetaData, std::size_t, counted_weight_bucketed_edge_storage_config>;
+    using counted_edge_t = typename counted_gen_t::edge_type;
+    static_assert(std::is_same_v<counted_edge_t, EdgeType<object::counted_shared<EdgeWeight>, EdgeMetaData, std::size_t>>);
+    static_assert(has_shared_weight_v<counted_edge_t>);
+    static_assert(sizeof(counted_edge_t) < sizeof(edge_t));
   }
 
 
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "DynamicGraphEdgeLookupFreeTest.hpp"
+#include "DynamicGraphTestingUtilities.hpp"
+
+namespace sequoia::testing
+{
+  using namespace maths;
+
+  namespace
+  {
+    using directed_type   = directed_graph<null_weight, null_weight>;
+    using undirected_type = undirected_graph<null_weight, null_weight>;
+    using weighted_type   = undirected_graph<int, null_weight>;
+    using embedded_type   = embedded_graph<null_weight, null_weight>;
+    using size_type       = directed_type::size_type;
+    using indices         = std::vector<size_type>;
+
+    template<class G>
+    [[nodiscard]]
+    indices targets(const G& g, size_type node)
+    {
+      indices t{};
+      for(const auto& e : g.cedges(node)) t.push_back(e.target_node());
+
+      return t;
+    }
+
+    template<class G>
+    [[nodiscard]]
+    std::vector<int> weights(const G& g, size_type node)
+    {
+      std::vector<int> w{};
+      for(const auto& e : g.cedges(node)) w.push_back(e.weight());
+
+      return w;
+    }
+
+    template<class G>
+    void sort_by_target(G& g)
+    {
+      for(size_type n{}; n < g.order(); ++n)
+        g.sort_edges(g.cedges(n), [](const auto& lhs, const auto& rhs) { return lhs.target_node() < rhs.target_node(); });
+    }
+  }
+
+  [[nodiscard]]
+  std::filesystem::path dynamic_graph_edge_lookup_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void dynamic_graph_edge_lookup_free_test::run_tests()
+  {
+    test_find_edge();
+    test_join_unique();
+    test_sorted_join_unique();
+    test_sorted_erase_edge();
+  }
+
+  void dynamic_graph_edge_lookup_free_test::test_find_edge()
+  {
+    {
+      // Graph:
+      // 0 -> 2, 0 -> 1, 0 -> 2, 1 -> 1
+
+      const directed_type g{{{2}, {1}, {2}}, {{1}}, {}};
+
+      check(equality, "Present edge", g.find_edge(0, 1), g.cbegin_edges(0) + 1);
+      check(equality, "First of parallel edges", g.find_edge(0, 2), g.cbegin_edges(0));
+      check(equality, "Loop", g.find_edge(1, 1), g.cbegin_edges(1));
+      check(equality, "Absent edge", g.find_edge(1, 0), g.cend_edges(1));
+      check("Directed edges are not symmetric", g.contains_edge(0, 1) && !g.contains_edge(1, 0));
+      check("Isolated node", !g.contains_edge(2, 0));
+
+      check_exception_thrown<std::out_of_range>("Source out of range", [&g]() { return g.find_edge(3, 0); });
+      check_exception_thrown<std::out_of_range>("Target out of range", [&g]() { return g.contains_edge(0, 3, sorted_edges); });
+    }
+
+    {
+      undirected_type g{{{3}, {1}, {3}}, {{0}, {2}}, {{1}}, {{0}, {0}}};
+      check("Unsorted lookup", g.contains_edge(3, 0) && !g.contains_edge(3, 1));
+
+      sort_by_target(g);
+      check(equality, "Sorted lookup", g.find_edge(0, 3, sorted_edges), g.cbegin_edges(0) + 1);
+      check(equality, "Sorted lookup of first", g.find_edge(1, 0, sorted_edges), g.cbegin_edges(1));
+      check(equality, "Sorted lookup beyond last", g.find_edge(2, 3, sorted_edges), g.cend_edges(2));
+      check(equality, "Sorted lookup before first", g.find_edge(3, 0, sorted_edges), g.cbegin_edges(3));
+
+      for(size_type i{}; i < g.order(); ++i)
+      {
+        for(size_type j{}; j < g.order(); ++j)
+        {
+          check(equality, std::format("Sorted and unsorted lookups of {} -> {}", i, j), g.contains_edge(i, j, sorted_edges), g.contains_edge(i, j));
+        }
+      }
+    }
+
+    {
+      embedded_type g{{{1, 0}}, {{0, 0}}};
+      check("Embedded", g.contains_edge(0, 1) && g.contains_edge(1, 0) && !g.contains_edge(0, 0));
+    }
+  }
+
+  void dynamic_graph_edge_lookup_free_test::test_join_unique()
+  {
+    {
+      directed_type g{};
+      g.add_node();
+      g.add_node();
+
+      check("New edge", g.join_unique(0, 1));
+      check("Duplicate edge", !g.join_unique(0, 1));
+      check("Reverse edge", g.join_unique(1, 0));
+      check("Loop", g.join_unique(1, 1));
+      check("Duplicate loop", !g.join_unique(1, 1));
+      check(equality, "Directed", g, directed_type{{{1}}, {{0}, {1}}});
+    }
+
+    {
+      undirected_type g{};
+      g.add_node();
+      g.add_node();
+
+      check("New edge", g.join_unique(1, 0));
+      check("Duplicate edge", !g.join_unique(1, 0));
+      check("Reversed duplicate edge", !g.join_unique(0, 1));
+      check(equality, "Undirected", g, undirected_type{{{1}}, {{0}}});
+    }
+
+    {
+      embedded_type g{};
+      g.add_node();
+      g.add_node();
+
+      check("New edge", g.join_unique(0, 1));
+      check("Reversed duplicate edge", !g.join_unique(1, 0));
+      check(equality, "Embedded", g, embedded_type{{{1, 0}}, {{0, 0}}});
+    }
+
+    {
+      weighted_type g{};
+      g.add_node();
+      g.add_node();
+
+      check("New weighted edge", g.join_unique(0, 1, 4));
+      check("Duplicate edge with a different weight", !g.join_unique(0, 1, 5));
+      check(equality, "Weight of retained edge", weights(g, 1), std::vector<int>{4});
+
+      check_exception_thrown<std::out_of_range>("Node out of range", [&g]() { return g.join_unique(0, 2, 1); });
+    }
+  }
+
+  void dynamic_graph_edge_lookup_free_test::test_sorted_join_unique()
+  {
+    {
+      directed_type g{};
+      for(size_type i{}; i < 4; ++i) g.add_node();
+
+      for(auto [from, to] : std::vector<std::pair<size_type, size_type>>{{0, 3}, {0, 1}, {0, 3}, {0, 0}, {0, 2}, {2, 0}, {0, 1}})
+        g.join_unique(from, to, sorted_edges);
+
+      check(equality, "Directed edges in order", targets(g, 0), indices{0, 1, 2, 3});
+      check(equality, "Directed edges in order", targets(g, 2), indices{0});
+      check(equality, "Size", g.size(), size_type{5});
+    }
+
+    {
+      undirected_type g{};
+      for(size_type i{}; i < 4; ++i) g.add_node();
+
+      check("New edge", g.join_unique(2, 0, sorted_edges));
+      check("New edge", g.join_unique(3, 0, sorted_edges));
+      check("New edge", g.join_unique(1, 0, sorted_edges));
+      check("Loop", g.join_unique(0, 0, sorted_edges));
+      check("Duplicate loop", !g.join_unique(0, 0, sorted_edges));
+      check("Reversed duplicate edge", !g.join_unique(0, 3, sorted_edges));
+      check("New edge", g.join_unique(3, 2, sorted_edges));
+
+      check(equality, "Undirected edges in order", targets(g, 0), indices{0, 0, 1, 2, 3});
+      check(equality, "Undirected edges in order", targets(g, 1), indices{0});
+      check(equality, "Undirected edges in order", targets(g, 2), indices{0, 3});
+      check(equality, "Undirected edges in order", targets(g, 3), indices{0, 2});
+      check(equality, "Size", g.size(), size_type{5});
+    }
+
+    {
+      weighted_type g{};
+      for(size_type i{}; i < 3; ++i) g.add_node();
+
+      g.join_unique(0, 2, sorted_edges, 2);
+      g.join_unique(0, 1, sorted_edges, 1);
+      g.join_unique(1, 1, sorted_edges, 3);
+      g.join_unique(0, 2, sorted_edges, 7);
+
+      check(equality, "Weights follow their edges", weights(g, 0), std::vector<int>{1, 2});
+      check(equality, "Weights follow their edges", weights(g, 1), std::vector<int>{1, 3, 3});
+      check(equality, "Weights follow their edges", weights(g, 2), std::vector<int>{2});
+      check(equality, "Equivalent to unordered construction", g, weighted_type{{{1, 1}, {2, 2}}, {{0, 1}, {1, 3}, {1, 3}}, {{0, 2}}});
+    }
+  }
+
+  void dynamic_graph_edge_lookup_free_test::test_sorted_erase_edge()
+  {
+    {
+      undirected_type g{{{1}, {2}, {3}}, {{0}, {1}, {1}, {3}}, {{0}}, {{0}, {1}}};
+      sort_by_target(g);
+
+      g.erase_edge(g.find_edge(3, 1, sorted_edges), sorted_edges);
+      check(equality, "Erase edge", g, undirected_type{{{1}, {2}, {3}}, {{0}, {1}, {1}}, {{0}}, {{0}}});
+
+      g.erase_edge(g.find_edge(1, 1, sorted_edges), sorted_edges);
+      check(equality, "Erase loop", g, undirected_type{{{1}, {2}, {3}}, {{0}}, {{0}}, {{0}}});
+
+      g.erase_edge(g.find_edge(0, 2, sorted_edges), sorted_edges);
+      check(equality, "Erase edge", g, undirected_type{{{1}, {3}}, {{0}}, {}, {{0}}});
+    }
+
+    {
+      // Parallel edges, distinguished by their weights
+
+      weighted_type g{{{1, 5}, {1, 2}, {2, 1}}, {{0, 2}, {0, 5}}, {{0, 1}}};
+      sort_by_target(g);
+
+      g.erase_edge(g.find_edge(1, 0, sorted_edges) + 1, sorted_edges);
+      check(equality, "Partner with matching weight", weights(g, 0), std::vector<int>{2, 1});
+      check(equality, "Partner with matching weight", weights(g, 1), std::vector<int>{2});
+    }
+
+    {
+      directed_type g{{{1}, {0}}, {{0}}};
+      sort_by_target(g);
+
+      g.erase_edge(g.find_edge(0, 1, sorted_edges), sorted_edges);
+      check(equality, "Directed", g, directed_type{{{0}}, {{0}}});
+    }
+  }
+}
@@ -50,6 +50,15 @@ namespace sequoia::testing
     constexpr static maths::edge_sharing_preference edge_sharing{maths::edge_sharing_preference::shared_weight};
   };
 
+  struct counted_weight_contiguous_edge_storage_config
+  {
+    template <class T> using storage_type = data_structures::partitioned_sequence<T>;
+
+    template <class W> using shared_weight_handler = object::counted_shared<W>;
+
+    constexpr static maths::edge_sharing_preference edge_sharing{maths::edge_sharing_preference::shared_weight};
+  };
+
   // Meta
 
   [[nodiscard]]
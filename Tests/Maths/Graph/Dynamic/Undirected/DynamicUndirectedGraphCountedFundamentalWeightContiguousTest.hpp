@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file */
+
+#include "sequoia/TestFramework/RegularTestCore.hpp"
+
+namespace sequoia::testing
+{
+  class dynamic_undirected_graph_counted_fundamental_weight_contiguous_test final : public regular_test
+  {
+  public:
+    using regular_test::regular_test;
+
+    [[nodiscard]]
+    std::filesystem::path source_file() const;
+
+    void run_tests();
+  };
+}
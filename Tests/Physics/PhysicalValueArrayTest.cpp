@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "PhysicalValueArrayTest.hpp"
+
+namespace sequoia::testing
+{
+  using namespace physics;
+
+  [[nodiscard]]
+  std::filesystem::path physical_value_array_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void physical_value_array_test::run_tests()
+  {
+    test_batch_validation();
+    test_absolute_arrays();
+    test_affine_arrays();
+    test_conversions();
+  }
+
+  void physical_value_array_test::test_batch_validation()
+  {
+    {
+      half_line_validator validator{};
+      std::array values{1.0, 0.0, 2.0};
+      validate_batch(validator, std::span<double>{values});
+      check(equality, "Valid half-line batch", values, std::array{1.0, 0.0, 2.0});
+
+      std::array invalid{1.0, -0.5, 2.0};
+      check_exception_thrown<std::domain_error>("Invalid half-line batch", [&](){ validate_batch(validator, std::span<double>{invalid}); });
+    }
+
+    {
+      interval_validator<double, 0.0, 1.0> validator{};
+      std::array values{0.25, 1.0};
+      validate_batch(validator, std::span<double>{values});
+      check(equality, "Valid interval batch", values, std::array{0.25, 1.0});
+
+      std::array invalid{0.25, 1.5};
+      check_exception_thrown<std::domain_error>("Invalid interval batch", [&](){ validate_batch(validator, std::span<double>{invalid}); });
+    }
+  }
+
+  void physical_value_array_test::test_absolute_arrays()
+  {
+    using mass_t   = si::mass<double>;
+    using masses_t = quantity_array<si::units::kilogram_t, double>;
+    STATIC_CHECK(std::is_same_v<masses_t::element_type, mass_t>);
+
+    const std::vector<double> values{1.0, 2.0, 3.0};
+    masses_t m{values, si::units::kilogram};
+    check(equality, "Size", m.size(), 3uz);
+    check(equality, "Element", m[1], mass_t{2.0, si::units::kilogram});
+    check(equality, "Construction from elements", m, masses_t{mass_t{1.0, si::units::kilogram}, mass_t{2.0, si::units::kilogram}, mass_t{3.0, si::units::kilogram}});
+
+    check_exception_thrown<std::domain_error>("Negative mass", [](){ return masses_t{std::vector{1.0, -2.0}, si::units::kilogram}; });
+
+    check(equality, "Sum", m + m, masses_t{std::vector{2.0, 4.0, 6.0}, si::units::kilogram});
+    check(equality, "Scaling", 2.0 * m, m + m);
+    check(equality, "Division", m / 2.0, masses_t{std::vector{0.5, 1.0, 1.5}, si::units::kilogram});
+    check_exception_thrown<std::domain_error>("Negative scaling", [&m](){ return m * -1.0; });
+
+    const auto delta{masses_t{std::vector{0.5, 0.5, 0.5}, si::units::kilogram} - m};
+    STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(delta)>::element_type, mass_t::displacement_type>);
+    check(equality, "Difference", delta[2], mass_t{0.5, si::units::kilogram} - mass_t{3.0, si::units::kilogram});
+
+    const auto ratio{m / m};
+    check(equality, "Ratio", ratio[0], mass_t{1.0, si::units::kilogram} / mass_t{1.0, si::units::kilogram});
+
+    check_exception_thrown<std::logic_error>("Size mismatch", [&m](){ return m + masses_t{std::vector{1.0}, si::units::kilogram}; });
+  }
+
+  void physical_value_array_test::test_affine_arrays()
+  {
+    using position_t  = si::position<double, 2>;
+    using positions_t = physical_value_array<position_t>;
+    using delta_t     = position_t::displacement_type;
+
+    const positions_t x{std::vector{1.0, 2.0, -1.0, -2.0}, si::units::metre};
+    check(equality, "Size", x.size(), 2uz);
+    check(equality, "Element", x[1], position_t{2.0, -2.0, si::units::metre});
+
+    const auto dx{x - x};
+    STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(dx)>::element_type, delta_t>);
+    check(equality, "Displacement", dx[0], delta_t{0.0, 0.0, si::units::metre});
+
+    check_exception_thrown<std::logic_error>("Values not a multiple of the dimension", [](){ return positions_t{std::vector{1.0, 2.0, 3.0}, si::units::metre}; });
+  }
+
+  void physical_value_array_test::test_conversions()
+  {
+    using masses_t = quantity_array<si::units::kilogram_t, double>;
+
+    const masses_t m{std::vector{1000.0, 500.0}, si::units::kilogram};
+    const auto t{m.convert_to(si::units::tonne)};
+    check(equality, "Tonnes", t[0], m[0].convert_to(si::units::tonne));
+    check(equality, "Tonnes", t[1], m[1].convert_to(si::units::tonne));
+    check(equality, "Identity conversion", m.convert_to(si::units::kilogram), m);
+  }
+}
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+/*! \file */
+
+#include "PhysicalValueTestingUtilities.hpp"
+
+namespace sequoia::testing
+{
+  class physical_value_array_test final : public regular_test
+  {
+  public:
+    using regular_test::regular_test;
+
+    [[nodiscard]]
+    std::filesystem::path source_file() const;
+
+    void run_tests();
+  private:
+    void test_batch_validation();
+
+    void test_absolute_arrays();
+
+    void test_affine_arrays();
+
+    void test_conversions();
+  };
+}
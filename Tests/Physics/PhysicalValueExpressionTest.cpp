@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "PhysicalValueExpressionTest.hpp"
+
+#include "sequoia/Physics/PhysicalValueExpressions.hpp"
+
+namespace sequoia::testing
+{
+  using namespace physics;
+
+  namespace
+  {
+    template<class Array>
+    inline constexpr bool composes_temporary_array{
+      requires(const Array& a) { lazy(a) + Array{}; } || requires(const Array& a) { Array{} * lazy(a); }
+    };
+  }
+
+  [[nodiscard]]
+  std::filesystem::path physical_value_expression_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void physical_value_expression_test::run_tests()
+  {
+    test_scalar_expressions();
+    test_intermediate_validation();
+    test_bulk_expressions();
+  }
+
+  void physical_value_expression_test::test_scalar_expressions()
+  {
+    using mass_t = si::mass<double>;
+    using interval_t = si::time_interval<double>;
+
+    const mass_t m1{1.0, si::units::kilogram}, m2{3.0, si::units::kilogram};
+    const interval_t t{2.0, si::units::second};
+
+    const auto expr{(lazy(m1) + m2) * 2.0 / t};
+    STATIC_CHECK(physical_expression<decltype(expr)>);
+    STATIC_CHECK(std::is_same_v<decltype(evaluate(expr)), decltype((m1 + m2) * 2.0 / t)>);
+    check(equality, "Fused rate", evaluate(expr), (m1 + m2) * 2.0 / t);
+
+    const auto delta{evaluate(lazy(m1) - m2)};
+    STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(delta)>, mass_t::displacement_type>);
+    check(equality, "Difference", delta, m1 - m2);
+
+    check(equality, "Difference followed by sum", evaluate(lazy(m1) - m2 + m2), m1);
+    check(equality, "Dimensionless ratio", evaluate(lazy(m2) / m1), m2 / m1);
+  }
+
+  void physical_value_expression_test::test_intermediate_validation()
+  {
+    using mass_t = si::mass<double>;
+    const mass_t m{1.0, si::units::kilogram};
+
+    STATIC_CHECK(decltype(lazy(m) + m)::preserves_validity);
+    STATIC_CHECK(decltype(lazy(m) * m)::preserves_validity);
+    STATIC_CHECK(decltype(lazy(m) - m)::preserves_validity);
+    STATIC_CHECK(!decltype(lazy(m) * 2.0)::preserves_validity);
+
+    check_exception_thrown<std::domain_error>("Negative intermediate", [&m](){ return evaluate(lazy(m) * -1.0 * -1.0); });
+    check_exception_thrown<std::domain_error>("Negative result", [&m](){ return evaluate(lazy(m) * -1.0); });
+  }
+
+  void physical_value_expression_test::test_bulk_expressions()
+  {
+    using mass_t   = si::mass<double>;
+    using masses_t = quantity_array<si::units::kilogram_t, double>;
+    using interval_t   = si::time_interval<double>;
+
+    const masses_t a{std::vector{1.0, 2.0, 4.0}, si::units::kilogram}, b{std::vector{3.0, 2.0, 0.0}, si::units::kilogram};
+    check(equality, "Bulk sum", evaluate(lazy(a) + b), a + b);
+    check(equality, "Bulk sum with broadcast", evaluate(lazy(a) + b + mass_t{1.0, si::units::kilogram}), masses_t{std::vector{5.0, 5.0, 5.0}, si::units::kilogram});
+
+    const interval_t t{2.0, si::units::second};
+    const auto rates{evaluate((lazy(a) + b) * 2.0 / t)};
+    check(equality, "Size", rates.size(), 3uz);
+    for(std::size_t k{}; k < rates.size(); ++k)
+    {
+      check(equality, std::format("Rate {}", k), rates[k], (a[k] + b[k]) * 2.0 / t);
+    }
+
+    check_exception_thrown<std::domain_error>("Invalid batch", [&a](){ return evaluate(lazy(a) * -1.0); });
+    const masses_t c{std::vector{1.0}, si::units::kilogram};
+    check_exception_thrown<std::logic_error>("Size mismatch", [&a, &c](){ return evaluate(lazy(a) + c); });
+
+    STATIC_CHECK(!composes_temporary_array<masses_t>);
+  }
+}
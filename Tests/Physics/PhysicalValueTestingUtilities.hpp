@@ -10,7 +10,7 @@
 /*! \file */
 
 #include "sequoia/TestFramework/RegularTestCore.hpp"
-#include "sequoia/Physics/PhysicalValues.hpp"
+#include "sequoia/Physics/PhysicalValueArrays.hpp"
 
 namespace sequoia::testing
 {
@@ -55,6 +55,23 @@ namespace sequoia::testing
     }
   };
 
+  template<class PhysicalValue>
+  struct value_tester<physics::physical_value_array<PhysicalValue>>
+  {
+    using type = physics::physical_value_array<PhysicalValue>;
+    constexpr static auto dimension{type::dimension};
+
+    template<test_mode Mode>
+    static void test(equality_check_t, test_logger<Mode>& logger, const type& actual, const type& prediction)
+    {
+      check(equality, "Size", logger, actual.size(), prediction.size());
+      for(std::size_t i{}; i < dimension; ++i)
+      {
+        check(equality, std::format("Component {}", i), logger, actual.component(i), prediction.component(i));
+      }
+    }
+  };
+
   template<
     maths::convex_space ValueSpace,
     class Unit,
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "FileEditorsFreeTest.hpp"
+#include "sequoia/TestFramework/FileEditors.hpp"
+
+namespace sequoia::testing
+{
+  [[nodiscard]]
+  std::filesystem::path file_editors_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void file_editors_free_test::run_tests()
+  {
+    test_masking_patterns();
+    test_masking_patterns_with_backreferences();
+    test_overlapping_masking_patterns();
+  }
+
+  void file_editors_free_test::test_masking_patterns()
+  {
+    {
+      const masking_patterns patterns{};
+      check("No patterns", patterns.empty());
+      check(equality, "Text unchanged", patterns.apply("Time: 1.2s]"), std::string{"Time: 1.2s]"});
+    }
+
+    {
+      const masking_patterns patterns{": .*s\\]"};
+      check(equality, "Number of patterns", patterns.size(), std::size_t{1});
+      check(equality, "Single pattern", patterns.apply("Time: 1.2s] done"), std::string{"Time done"});
+      check(equality, "No match", patterns.apply("Time 1.2s"), std::string{"Time 1.2s"});
+    }
+
+    {
+      const masking_patterns patterns{"foo\n[0-9]+\nbar\n"};
+      check(equality, "Number of patterns", patterns.size(), std::size_t{3});
+      check(equality, "Multiple patterns", patterns.apply("foo 42 bar baz"), std::string{"   baz"});
+    }
+
+    {
+      const masking_patterns patterns{"foo\n\nbar"};
+      check(equality, "Patterns following an empty line are ignored", patterns.size(), std::size_t{1});
+      check(equality, "Pattern after empty line not applied", patterns.apply("foo bar"), std::string{" bar"});
+    }
+  }
+
+  void file_editors_free_test::test_masking_patterns_with_backreferences()
+  {
+    const masking_patterns patterns{"(a)\\1\n(b)c\nx"};
+    check(equality, "Number of patterns", patterns.size(), std::size_t{3});
+    check(equality, "Mixed patterns", patterns.apply("aa bc x ab"), std::string{"   ab"});
+  }
+
+  void file_editors_free_test::test_overlapping_masking_patterns()
+  {
+    {
+      const masking_patterns patterns{": .*s\\]\n\\[.*s\\]"};
+      check(equality, "Earlier pattern applied first", patterns.apply("[Total Run Time: 1.1ms]"), std::string{"[Total Run Time"});
+    }
+
+    {
+      const masking_patterns patterns{"\\[.*s\\]\n: .*s\\]"};
+      check(equality, "Reversed order", patterns.apply("[Total Run Time: 1.1ms]"), std::string{});
+    }
+
+    {
+      const masking_patterns patterns{"ab\nxy"};
+      check(equality, "Match created by an earlier removal", patterns.apply("xaby"), std::string{});
+    }
+
+    {
+      const masking_patterns patterns{"bc\nab"};
+      check(equality, "Match destroyed by an earlier removal", patterns.apply("abc"), std::string{"a"});
+    }
+  }
+}
@@ -24,6 +24,7 @@ namespace sequoia::testing
   {
     test_find_in_tree();
     test_rebase_from();
+    test_take_snapshot();
   }
 
   void file_system_utilities_free_test::test_find_in_tree()
@@ -67,4 +68,38 @@ namespace sequoia::testing
     check(equality, "Relative", rebase_from(fs::path{"../Stuff.txt"}, working_materials()), fs::path{"Stuff.txt"});
     check(equality, "Double overlap", rebase_from(fs::path{"Foo/Bar/Stuff.txt"}, working_materials() /= "Foo/Bar"), fs::path{"Stuff.txt"});
   }
+
+  void file_system_utilities_free_test::test_take_snapshot()
+  {
+    const auto root{working_materials()}, fooPath{root / "Foo"};
+
+    {
+      const auto snapshot{take_snapshot(fooPath / "Thing.txt")};
+      check("Non-existent path", snapshot.type == fs::file_type::not_found);
+      check(equality, "No entries", snapshot.entries.size(), std::size_t{});
+    }
+
+    {
+      const auto snapshot{take_snapshot(fooPath / "baz.txt", snapshot_detail::metadata)};
+      check("Regular file", snapshot.is_regular_file());
+      check(equality, "File size", snapshot.size, static_cast<std::uintmax_t>(fs::file_size(fooPath / "baz.txt")));
+    }
+
+    const auto snapshot{take_snapshot(fooPath)};
+    check("Directory", snapshot.is_directory());
+    if(check(equality, "Number of entries", snapshot.entries.size(), std::size_t{2}))
+    {
+      const auto& bar{snapshot.entries[0]};
+      check(equality, "First entry", bar.path, fooPath / "Bar");
+      check("First entry is a directory", bar.is_directory());
+      check(equality, "Second entry", snapshot.entries[1].path, fooPath / "baz.txt");
+      check("Second entry is a file", snapshot.entries[1].is_regular_file());
+
+      if(check(equality, "Number of nested entries", bar.entries.size(), std::size_t{2}))
+      {
+        check(equality, "First nested entry", bar.entries[0].path, fooPath / "Bar" / "baz.txt");
+        check(equality, "Second nested entry", bar.entries[1].path, fooPath / "Bar" / "plurgh.txt");
+      }
+    }
+  }
 }
@@ -26,5 +26,7 @@ namespace sequoia::testing
     void test_find_in_tree();
 
     void test_rebase_from();
+
+    void test_take_snapshot();
   };
 }
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "MaterialsStagingFreeTest.hpp"
+#include "sequoia/Streaming/Streaming.hpp"
+
+namespace sequoia::testing
+{
+  namespace fs = std::filesystem;
+
+  [[nodiscard]]
+  std::filesystem::path materials_staging_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void materials_staging_free_test::run_tests()
+  {
+    test_staging(file_staging::copy, "Copy");
+    test_staging(file_staging::clone, "Clone");
+    test_staging(file_staging::link, "Link");
+    test_staging_modes();
+    test_symlinks();
+  }
+
+  void materials_staging_free_test::test_staging(file_staging staging, std::string_view description)
+  {
+    const auto source{working_materials() / "Source"}, target{working_materials() / "Staged" / description};
+    const auto stats{stage_directory(source, target, staging)};
+
+    const std::string desc{description};
+    check(equality, desc + ": number of files", stats.files, std::size_t{2});
+    check(equality, desc + ": total bytes", stats.total_bytes(), std::uintmax_t{22});
+    check(equality, desc + ": Hello.txt", read_to_string(target / "Hello.txt"), read_to_string(source / "Hello.txt"));
+    check(equality, desc + ": Nested/Bye.txt", read_to_string(target / "Nested" / "Bye.txt"), read_to_string(source / "Nested" / "Bye.txt"));
+
+    switch(staging)
+    {
+    case file_staging::copy:
+      check(equality, desc + ": bytes copied", stats.bytes_copied, std::uintmax_t{22});
+      break;
+    case file_staging::clone:
+      check(equality, desc + ": nothing linked", stats.bytes_linked, std::uintmax_t{});
+      break;
+    case file_staging::link:
+      if(stats.bytes_linked)
+        check(desc + ": linked", fs::equivalent(target / "Hello.txt", source / "Hello.txt"));
+      break;
+    }
+  }
+
+  void materials_staging_free_test::test_staging_modes()
+  {
+    check("Working, copy", working_staging(staging_mode::copy) == file_staging::copy);
+    check("Working, clone", working_staging(staging_mode::clone) == file_staging::clone);
+    check("Working, link", working_staging(staging_mode::link) == file_staging::clone);
+
+    check("Auxiliary, copy", auxiliary_staging(staging_mode::copy) == file_staging::copy);
+    check("Auxiliary, clone", auxiliary_staging(staging_mode::clone) == file_staging::clone);
+    check("Auxiliary, link", auxiliary_staging(staging_mode::link) == file_staging::link);
+  }
+
+  void materials_staging_free_test::test_symlinks()
+  {
+    const auto linked{working_materials() / "Linked"};
+    fs::create_directories(linked);
+
+    // Creating symlinks may require privileges which are not available on all platforms
+    std::error_code ec{};
+    fs::create_directory_symlink(working_materials() / "Source" / "Nested", linked / "Nested", ec);
+    if(ec) return;
+
+    const auto stats{stage_directory(linked, working_materials() / "Staged" / "Linked", file_staging::copy)};
+    check(equality, "Contents of a symlinked directory are staged", stats.files, std::size_t{1});
+    check(equality, "Contents of a symlinked directory are staged",
+          read_to_string(working_materials() / "Staged" / "Linked" / "Nested" / "Bye.txt"),
+          read_to_string(working_materials() / "Source" / "Nested" / "Bye.txt"));
+
+    fs::create_symlink(working_materials() / "Missing.txt", linked / "Dangling.txt");
+    check_exception_thrown<std::runtime_error>("Dangling symlink",
+      [&]() { return stage_directory(linked, working_materials() / "Staged" / "Dangling", file_staging::copy); });
+  }
+}
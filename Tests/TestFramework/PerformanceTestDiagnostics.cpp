@@ -9,6 +9,8 @@
 
 #include "PerformanceTestDiagnostics.hpp"
 
+#include <numeric>
+
 namespace sequoia::testing
 {
   namespace
@@ -56,6 +58,7 @@ namespace sequoia::testing
   void performance_false_positive_diagnostics::run_tests()
   {
     test_relative_performance();
+    test_counter_bounds();
   }
 
   void performance_false_positive_diagnostics::test_relative_performance()
@@ -64,6 +67,15 @@ namespace sequoia::testing
     check_relative_performance("Performance Test which should pass", []() { wait(delta_t); }, []() { wait(4 * delta_t); }, 3.4, 4.1, 5);
   }
 
+  void performance_false_positive_diagnostics::test_counter_bounds()
+  {
+    std::vector<int> data(1024, 1);
+    auto sum{[&data]() { return std::accumulate(data.begin(), data.end(), 0); }};
+
+    check_counter_bound("Counter bound which should pass", counter_kind::instructions, sum, 1000.0, data.size());
+    check_counter_bound("Counter bound which should pass", counter_kind::l1d_read_misses, sum, 10.0, data.size());
+  }
+
   [[nodiscard]]
   std::filesystem::path performance_utilities_test::source_file() const
   {
@@ -73,6 +85,25 @@ namespace sequoia::testing
   void performance_utilities_test::run_tests()
   {
     test_postprocessing();
+    test_counters();
+  }
+
+  void performance_utilities_test::test_counters()
+  {
+    check(equality, "", to_string(counter_kind::branch_misses), std::string{"branch misses"});
+
+    const auto readings{measure_counters([](){}, {counter_kind::instructions, counter_kind::context_switches})};
+
+    check("Unrequested counter", !readings.available(counter_kind::cycles));
+    check("Unrequested counter", !readings.available(counter_kind::cache_misses));
+
+    {
+      counter_group group{counter_kind::cycles};
+      check(equality, "", group.available(counter_kind::cycles), group.any_available());
+
+      counter_group other{std::move(group)};
+      check("Moved-from group", !group.any_available());
+    }
   }
 
   void performance_utilities_test::test_postprocessing()
@@ -38,6 +38,8 @@ namespace sequoia::testing
   private:
 
     void test_relative_performance();
+
+    void test_counter_bounds();
   };
 
   class performance_utilities_test final : public free_test
@@ -52,5 +54,7 @@ namespace sequoia::testing
   private:
 
     void test_postprocessing();
+
+    void test_counters();
   };
 }
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "ShardingFreeTest.hpp"
+#include "sequoia/TestFramework/Sharding.hpp"
+
+#include <sstream>
+
+namespace sequoia::testing
+{
+  [[nodiscard]]
+  std::filesystem::path sharding_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void sharding_free_test::run_tests()
+  {
+    test_parsing();
+    test_balancing();
+    test_records();
+  }
+
+  void sharding_free_test::test_parsing()
+  {
+    check("0/1", parse_shard("0/1") == shard_spec{.index{0}, .count{1}});
+    check("2/3", parse_shard("2/3") == shard_spec{.index{2}, .count{3}});
+    check(equality, "Round trip", to_string(parse_shard("4/7")), std::string{"4/7"});
+
+    check_exception_thrown<std::runtime_error>("Index too large", [](){ return parse_shard("3/3"); });
+    check_exception_thrown<std::runtime_error>("No separator", [](){ return parse_shard("3"); });
+    check_exception_thrown<std::runtime_error>("Not a number", [](){ return parse_shard("a/3"); });
+    check_exception_thrown<std::runtime_error>("Trailing characters", [](){ return parse_shard("1/3x"); });
+  }
+
+  void sharding_free_test::test_balancing()
+  {
+    using namespace std::chrono_literals;
+    using duration = log_summary::duration;
+
+    check(equality, "Single shard", balance_shards(std::vector<duration>{1s, 2s, 3s}, 1), std::vector<std::size_t>{0, 0, 0});
+    check(equality, "Equal weights", balance_shards(std::vector<duration>{1s, 1s, 1s, 1s}, 2), std::vector<std::size_t>{0, 1, 0, 1});
+    check(equality, "Heaviest first", balance_shards(std::vector<duration>{1s, 5s, 2s, 2s}, 2), std::vector<std::size_t>{1, 0, 1, 1});
+    check(equality, "More shards than weights", balance_shards(std::vector<duration>{1s, 2s}, 3), std::vector<std::size_t>{1, 0});
+
+    check_exception_thrown<std::logic_error>("No shards", [](){ return balance_shards(std::vector<duration>{}, 0); });
+  }
+
+  void sharding_free_test::test_records()
+  {
+    test_logger<test_mode::standard> logger{};
+    {
+      sentinel<test_mode::standard> sentry{logger, ""};
+      sentry.log_critical_failure("Something \"quoted\"\nover two lines");
+    }
+
+    const shard_record record{"Foo/Bar Test.cpp", log_summary{"Bar Test", logger, std::chrono::milliseconds{42}}};
+
+    std::stringstream stream{};
+    stream << record << record;
+
+    shard_record first{}, second{};
+    stream >> first >> second;
+
+    for(const auto& parsed : {first, second})
+    {
+      check(equality, "Source", parsed.source, record.source);
+      check(equality, "Name", parsed.summary.name(), record.summary.name());
+      check(equality, "Failure messages", parsed.summary.failure_messages(), record.summary.failure_messages());
+      check(equality, "Critical failures", parsed.summary.critical_failures(), record.summary.critical_failures());
+      check(equality, "Execution time", parsed.summary.execution_time(), record.summary.execution_time());
+    }
+
+    shard_record truncated{};
+    std::stringstream partial{"$Source: \"Foo.cpp\"\n$Summary: \"Foo\"\n"};
+    check("Truncated record", !(partial >> truncated));
+  }
+}
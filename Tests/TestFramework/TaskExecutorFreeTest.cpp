@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "TaskExecutorFreeTest.hpp"
+
+#include <numeric>
+
+namespace sequoia::testing
+{
+  [[nodiscard]]
+  std::filesystem::path task_executor_free_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void task_executor_free_test::run_tests()
+  {
+    test_for_each(task_executor{}, "Serial");
+    test_for_each(task_executor{4, thread_affinity::none}, "Pool");
+    test_for_each(task_executor{2, thread_affinity::pinned}, "Pinned pool");
+  }
+
+  void task_executor_free_test::test_for_each(const task_executor& executor, std::string_view description)
+  {
+    const std::string desc{description};
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 0);
+    executor.for_each(values, [](int& i) { i *= 2; });
+    check(equality, desc + ": sum", std::accumulate(values.begin(), values.end(), 0), 9900);
+
+    std::vector<std::vector<int>> nested(10, std::vector<int>(10, 1));
+    executor.for_each(nested, [&executor](std::vector<int>& v) {
+      executor.for_each(v, [](int& i) { ++i; });
+    });
+
+    check(equality, desc + ": nested", std::ranges::count(nested, std::vector<int>(10, 2)), std::ptrdiff_t{10});
+
+    check_exception_thrown<std::runtime_error>(
+      desc + ": exception",
+      [&executor, &values]() {
+        executor.for_each(values, [](int i) { if(i == 42) throw std::runtime_error{"42"}; });
+      }
+    );
+  }
+}
@@ -30,6 +30,7 @@ namespace sequoia::testing
     test_replace();
     test_replace_all();
     test_replace_all_recursive();
+    test_multi_replacer();
   }
 
   void substitutions_free_test::test_camel_case()
@@ -114,4 +115,32 @@ namespace sequoia::testing
     check(equality, "Expand 3 chevrons", replace_all_recursive(">>>", ">>", "> >"), "> > >"s);
     check(equality, "Expand 3 chevrons", replace_all_recursive(">>>>", ">>", "> >"), "> > > >"s);
   }
+
+  void substitutions_free_test::test_multi_replacer()
+  {
+    check_exception_thrown<std::logic_error>("Empty pattern", [](){ return multi_replacer{{"", "foo"}}; });
+
+    check(equality, "No patterns", multi_replacer{}.apply("foo"), "foo"s);
+    check(equality, "Replace in empty string", multi_replacer{{"foo", "bar"}}.apply(""), ""s);
+    check(equality, "Single replacement", multi_replacer{{"foo", "bar"}}.apply("foo"), "bar"s);
+    check(equality, "Multiple adjacent replacement", multi_replacer{{"foo", "bar"}}.apply("foofoo"), "barbar"s);
+    check(equality, "Overlapping occurrences", multi_replacer{{"aa", "b"}}.apply("aaa"), "ba"s);
+
+    const multi_replacer replacer{{"foo", "zoo"}, {"bar", "bfg"}, {"baz", "bat"}};
+    check(equality, "Multiple patterns", replace_all("foobarbaz", replacer), "zoobfgbat"s);
+    check(equality, "Multiple patterns, separated", replace_all("baz, foo; bar", replacer), "bat, zoo; bfg"s);
+
+    {
+      std::string text{"foo bar"};
+      check(equality, "Multiple patterns, in place", replace_all(text, replacer), "zoo bfg"s);
+    }
+
+    const std::vector<replacement> runtimeReplacements{{"?", "x"}, {"?Class", "Foo"}, {"?Class.hpp", "Foo.hpp"}};
+    check(equality, "Longest pattern preferred", replace_all("?Class.hpp ?Class ?", runtimeReplacements), "Foo.hpp Foo x"s);
+    check(equality, "Prefix of a longer pattern", replace_all("?Clas", runtimeReplacements), "xClas"s);
+    check(equality, "Pattern within a partial match", multi_replacer{{"abcd", "1"}, {"bc", "2"}}.apply("abce"), "a2e"s);
+    check(equality, "Leftmost match preferred", multi_replacer{{"bcd", "1"}, {"ab", "2"}}.apply("abcd"), "2cd"s);
+    check(equality, "Replacement is not rescanned", multi_replacer{{"a", "b"}, {"b", "a"}}.apply("ab"), "ba"s);
+    check(equality, "Repeated pattern", multi_replacer{{"a", "b"}, {"a", "c"}}.apply("aa"), "bb"s);
+  }
 }
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////
+//                Copyright Oliver J. Rosten 2026.                //
+// Distributed under the GNU GENERAL PUBLIC LICENSE, Version 3.0. //
+//    (See accompanying file LICENSE.md or copy at                //
+//          https://www.gnu.org/licenses/gpl-3.0.en.html)         //
+////////////////////////////////////////////////////////////////////
+
+/*! \file */
+
+#include "SubstitutionsPerformanceTest.hpp"
+
+#include "sequoia/TextProcessing/Substitutions.hpp"
+
+namespace sequoia::testing
+{
+  namespace
+  {
+    constexpr std::size_t num_patterns{32}, text_size{4'000'000};
+  }
+
+  [[nodiscard]]
+  std::filesystem::path substitutions_performance_test::source_file() const
+  {
+    return std::source_location::current().file_name();
+  }
+
+  void substitutions_performance_test::run_tests()
+  {
+    test_multi_pattern_replacement();
+  }
+
+  void substitutions_performance_test::test_multi_pattern_replacement()
+  {
+    std::vector<replacement> replacements{};
+    std::string chunk{};
+    for(std::size_t i{}; i < num_patterns; ++i)
+    {
+      const auto placeholder{std::string{"?name"}.append(std::to_string(i)).append("?")};
+      replacements.push_back({placeholder, std::string{"value_"}.append(std::to_string(i))});
+      chunk.append("  template text containing the placeholder ").append(placeholder).append(";\n");
+    }
+
+    std::string text{};
+    text.reserve(text_size + chunk.size());
+    while(text.size() < text_size) text.append(chunk);
+
+    const multi_replacer replacer{replacements};
+    auto singlePass{[&text, &replacer](){ return replacer.apply(text); }};
+
+    auto sequential{
+      [&text, &replacements](){
+        std::string str{text};
+        for(const auto& r : replacements) replace_all(str, r.from, r.to);
+        return str;
+      }
+    };
+
+    check(equality, "Single pass and sequential replacement agree", singlePass(), sequential());
+    check_relative_performance("Multi-pattern replacement; single pass/sequential", singlePass, sequential, 1.5, 50.0);
+  }
+}
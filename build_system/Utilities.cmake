@@ -3,12 +3,41 @@ set_property(GLOBAL PROPERTY CTEST_TARGETS_ADDED 1)
 include(CTest)
 
 option(CODE_COVERAGE "Build with Code Coverage" OFF)
+option(SEQUOIA_PRECOMPILED_HEADERS "Precompile the heavy sequoia headers for test targets" OFF)
+option(SEQUOIA_MODULES "Build sequoia named modules for test targets, where the toolchain supports them" OFF)
+option(SEQUOIA_UNITY_BUILD "Batch test sources, per directory, into unity translation units" OFF)
+set(SEQUOIA_UNITY_BATCH_SIZE 8 CACHE STRING "The maximum number of test sources in each unity translation unit")
 set(EXEC_ARGS "" CACHE STRING "Command-line arguments for the 'run' target.")
 
+# The headers, relative to the Source directory, which are either precompiled or exported from the named modules
+set(SEQUOIA_CORE_HEADERS
+    sequoia/Core/Concurrency/ConcurrencyModels.hpp
+    sequoia/Core/DataStructures/PartitionedData.hpp
+    sequoia/Core/Meta/TypeAlgorithms.hpp
+    sequoia/Core/Object/Suite.hpp)
+
+set(SEQUOIA_GRAPH_HEADERS
+    sequoia/Maths/Graph/DynamicGraph.hpp
+    sequoia/Maths/Graph/DynamicTree.hpp
+    sequoia/Maths/Graph/GraphTraversalFunctions.hpp
+    sequoia/Maths/Graph/HeterogeneousStaticGraph.hpp
+    sequoia/Maths/Graph/StaticGraph.hpp)
+
+set(SEQUOIA_PHYSICS_HEADERS
+    sequoia/Physics/PhysicalValues.hpp)
+
+set(SEQUOIA_TESTING_HEADERS
+    sequoia/TestFramework/FreeTestCore.hpp
+    sequoia/TestFramework/MoveOnlyTestCore.hpp
+    sequoia/TestFramework/PerformanceTestCore.hpp
+    sequoia/TestFramework/RegularAllocationTestCore.hpp
+    sequoia/TestFramework/RegularTestCore.hpp
+    sequoia/TestFramework/StateTransitionUtilities.hpp)
+
 FUNCTION(sequoia_init)
     if(NOT WIN32)
         find_package(Threads REQUIRED)
-        find_package(TBB REQUIRED)
+        find_package(TBB QUIET)
     endif()
 ENDFUNCTION()
 
@@ -17,7 +46,9 @@ FUNCTION(sequoia_link_libraries target)
         target_link_libraries(${target} PUBLIC winmm)
     else()
         target_link_libraries(${target} PUBLIC Threads::Threads)
-        target_link_libraries(${target} PUBLIC TBB::tbb)
+        if(TARGET TBB::tbb)
+            target_link_libraries(${target} PUBLIC TBB::tbb)
+        endif()
     endif()
 ENDFUNCTION()
 
@@ -81,7 +112,154 @@ FUNCTION(sequoia_add_coverage_options target)
     endif()
 ENDFUNCTION()
 
+FUNCTION(sequoia_precompile_headers target)
+    set(headers ${SEQUOIA_TESTING_HEADERS} ${SEQUOIA_CORE_HEADERS} ${SEQUOIA_GRAPH_HEADERS} ${SEQUOIA_PHYSICS_HEADERS})
+    list(TRANSFORM headers PREPEND "\"")
+    list(TRANSFORM headers APPEND "\"")
+    target_precompile_headers(${target} PRIVATE ${headers})
+ENDFUNCTION()
+
+FUNCTION(sequoia_modules_supported result)
+    set(${result} FALSE PARENT_SCOPE)
+    if(CMAKE_VERSION VERSION_LESS 3.28)
+        message(WARNING "SEQUOIA_MODULES requires CMake 3.28 or later")
+    elseif(NOT CMAKE_GENERATOR MATCHES "Ninja|Visual Studio")
+        message(WARNING "SEQUOIA_MODULES requires a Ninja or Visual Studio generator")
+    elseif((CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 14)
+           OR (CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 17)
+           OR (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 19.36))
+        message(WARNING "SEQUOIA_MODULES is not supported by ${CMAKE_CXX_COMPILER_ID} ${CMAKE_CXX_COMPILER_VERSION}")
+    else()
+        set(${result} TRUE PARENT_SCOPE)
+    endif()
+ENDFUNCTION()
+
+# Writes the interface unit of a module which exports the given headers. All standard headers used by
+# sequoia are included in the global module fragment so that, when the headers are subsequently included
+# within the module purview, only sequoia's own declarations are attached to the module.
+FUNCTION(sequoia_write_module_interface file moduleName)
+    file(GLOB_RECURSE sequoiaHeaders ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../Source/sequoia/*.hpp)
+    set(stdHeaders "")
+    foreach(header IN LISTS sequoiaHeaders)
+        file(STRINGS ${header} includes REGEX "^[ \t]*#include <[a-z_]+>")
+        list(TRANSFORM includes REPLACE "^[ \t]*#include (<[a-z_]+>).*" "\\1")
+        list(APPEND stdHeaders ${includes})
+    endforeach()
+    list(REMOVE_DUPLICATES stdHeaders)
+    list(SORT stdHeaders)
+
+    set(text "module;\n\n")
+    foreach(header IN LISTS stdHeaders)
+        string(APPEND text "#include ${header}\n")
+    endforeach()
+
+    string(APPEND text "\nexport module ${moduleName};\n\nexport extern \"C++\" {\n")
+    foreach(header IN LISTS ARGN)
+        string(APPEND text "#include \"${header}\"\n")
+    endforeach()
+    string(APPEND text "}\n")
+
+    file(CONFIGURE OUTPUT ${file} CONTENT "${text}" @ONLY)
+ENDFUNCTION()
+
+FUNCTION(sequoia_add_modules)
+    if(TARGET sequoia_modules)
+        return()
+    endif()
+
+    set(moduleDir ${CMAKE_BINARY_DIR}/sequoia_modules)
+    sequoia_write_module_interface(${moduleDir}/Core.cppm sequoia.core ${SEQUOIA_CORE_HEADERS})
+    sequoia_write_module_interface(${moduleDir}/Graph.cppm sequoia.maths.graph ${SEQUOIA_GRAPH_HEADERS})
+    sequoia_write_module_interface(${moduleDir}/Physics.cppm sequoia.physics ${SEQUOIA_PHYSICS_HEADERS})
+    sequoia_write_module_interface(${moduleDir}/Testing.cppm sequoia.testing ${SEQUOIA_TESTING_HEADERS})
+
+    add_library(sequoia_modules STATIC)
+    target_sources(sequoia_modules PUBLIC
+                   FILE_SET CXX_MODULES
+                   BASE_DIRS ${moduleDir}
+                   FILES ${moduleDir}/Core.cppm ${moduleDir}/Graph.cppm ${moduleDir}/Physics.cppm ${moduleDir}/Testing.cppm)
+    target_link_libraries(sequoia_modules PUBLIC sequoia)
+    sequoia_compile_features(sequoia_modules)
+
+    # A translation unit, added to each test target, which consumes the modules
+    file(CONFIGURE OUTPUT ${moduleDir}/Imports.cpp
+         CONTENT "import sequoia.core;\nimport sequoia.maths.graph;\nimport sequoia.physics;\nimport sequoia.testing;\n")
+ENDFUNCTION()
+
+# Sources which declare anonymous namespaces, or which have using-directives at any indentation, may
+# clash with other sources in the same unity translation unit, and so are compiled separately
+FUNCTION(sequoia_unity_safe source result)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${source})
+    file(STRINGS ${source} clashes REGEX "^[ \t]*namespace[ \t]*({.*)?$|^[ \t]*using namespace ")
+    if(clashes)
+        set(${result} FALSE PARENT_SCOPE)
+    else()
+        set(${result} TRUE PARENT_SCOPE)
+    endif()
+ENDFUNCTION()
+
+# Groups the test sources of target into unity translation units, each comprising at most
+# SEQUOIA_UNITY_BATCH_SIZE sources from a single directory. Since the groups are derived from
+# the target's sources, they are maintained automatically as tests are added.
+FUNCTION(sequoia_batch_test_sources target testDir)
+    cmake_path(SET testRoot NORMALIZE ${testDir})
+    get_target_property(sources ${target} SOURCES)
+
+    foreach(source IN LISTS sources)
+        if(NOT source MATCHES "\\.cpp$")
+            continue()
+        endif()
+
+        cmake_path(SET sourcePath NORMALIZE ${source})
+        cmake_path(IS_PREFIX testRoot ${sourcePath} isTest)
+        if(NOT isTest)
+            continue()
+        endif()
+
+        sequoia_unity_safe(${sourcePath} safe)
+        if(NOT safe)
+            set_source_files_properties(${source} PROPERTIES SKIP_UNITY_BUILD_INCLUSION ON)
+            continue()
+        endif()
+
+        cmake_path(GET sourcePath PARENT_PATH directory)
+        cmake_path(RELATIVE_PATH directory BASE_DIRECTORY ${testRoot})
+        string(MAKE_C_IDENTIFIER "unity_${directory}" key)
+
+        if(NOT DEFINED ${key}_count)
+            set(${key}_count 0)
+        endif()
+
+        math(EXPR batch "${${key}_count} / ${SEQUOIA_UNITY_BATCH_SIZE}")
+        math(EXPR ${key}_count "${${key}_count} + 1")
+        set_source_files_properties(${source} PROPERTIES UNITY_GROUP "${key}_${batch}")
+    endforeach()
+
+    set_target_properties(${target} PROPERTIES UNITY_BUILD ON UNITY_BUILD_MODE GROUP)
+ENDFUNCTION()
+
+FUNCTION(sequoia_configure_build_acceleration target testDir)
+    if(SEQUOIA_UNITY_BUILD)
+        sequoia_batch_test_sources(${target} ${testDir})
+    endif()
+
+    if(SEQUOIA_PRECOMPILED_HEADERS)
+        sequoia_precompile_headers(${target})
+    endif()
+
+    if(SEQUOIA_MODULES)
+        sequoia_modules_supported(supported)
+        if(supported)
+            sequoia_add_modules()
+            target_link_libraries(${target} PRIVATE sequoia_modules)
+            target_sources(${target} PRIVATE ${CMAKE_BINARY_DIR}/sequoia_modules/Imports.cpp)
+            set_source_files_properties(${CMAKE_BINARY_DIR}/sequoia_modules/Imports.cpp PROPERTIES SKIP_UNITY_BUILD_INCLUSION ON)
+        endif()
+    endif()
+ENDFUNCTION()
+
 FUNCTION(sequoia_finalize_tests target sourceGroupRoot sourceGroupPrefix)
+    sequoia_configure_build_acceleration(${target} ${sourceGroupRoot})
     sequoia_compile_features(${target})
     sequoia_set_compile_options(${target})
     sequoia_set_properties(${target})